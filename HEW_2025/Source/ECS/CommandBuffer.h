@@ -0,0 +1,113 @@
+/*****************************************************************//**
+ * @file   CommandBuffer.h
+ * @brief  World ւ̍\ύX(/j/ǉ/폜)񂵂ɂR}hobt@
+ *
+ * View ̑ Destroy/Add/Remove 𒼐ڌĂԂƁAXg[W̋lߒ
+ * ̕тĂ܂܂BSystem s͂ɐςłA
+ * SystemRegistry  System ̍(_)ł܂Ƃ߂ World ɔf܂B
+ *
+ * @author E
+ * @date   2025/11/11
+ *********************************************************************/
+#pragma once
+
+#include "ECS.h"
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <cstdint>
+
+class World;
+
+/**
+ * @class CommandBuffer
+ * @brief \ύXR}hL^AFlush() ł܂Ƃ߂ēKp
+ * @details
+ * - Create()  : GeBeBID͑ɊmۂĕԂiR|[lg͌ォς Add ŕtjB
+ *               World ̃Xbgz𒼐ڐL΂߁AWorld Xbĥ݌Ăׂ
+ * - Destroy() : j\
+ * - Add<T>()  : R|[lg̒ǉ(㏑)\Bl͂̎_ŃRs[/[uĕێ
+ * - Remove<T>(): R|[lg̍폜\
+ *
+ * Flush() ̓R}hXg[W(^ID)Ƃɂ܂Ƃ߁A^̒ł͋L^ۂēKpA
+ * j͍Ōɂ܂Ƃ߂čs܂BKp_ŊɎłGeBeBĂ Add/Remove ͎̂Ă܂B
+ * Destroy/Add/Remove ̋L^͓ŃbN̂ŁAWorld::ParallelView ̃R[obNς߂܂
+ * ȉꍇAXbhԂ̋L^͕słjBFlush/Clear ͓_ł̂݌ĂłB
+ * World ̌^`Ɉˑ镔 World.h ̖Œ`Ă܂B
+ */
+class CommandBuffer
+{
+public:
+	explicit CommandBuffer(World& world) : m_world(world), m_ownerThread(std::this_thread::get_id()) {}
+	~CommandBuffer() { Clear(); }
+
+	CommandBuffer(const CommandBuffer&) = delete;
+	CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+	/// GeBeB𐶐iID͑mہjBWorld XbhpŁAParallelView ͌ĂׂȂ
+	EntityId Create();
+
+	/// GeBeB̔j\񂷂
+	void Destroy(EntityId e);
+
+	/// R|[lg̒ǉ\񂷂
+	template <class T, class... Args>
+	void Add(EntityId e, Args&&... args);
+
+	/// R|[lg̍폜\񂷂
+	template <class T>
+	void Remove(EntityId e);
+
+	/// L^ς݃R}h World ֓Kp
+	void Flush();
+
+	/// Kp̃R}hj
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		for (auto& c : m_commands)
+		{
+			if (c.release)
+			{
+				c.release(c.payload);
+			}
+		}
+		m_commands.clear();
+	}
+
+	/// Kp̃R}h
+	bool Empty() const
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		return m_commands.empty();
+	}
+
+private:
+	using ApplyFn = void(*)(World&, EntityId, void*);
+	using ReleaseFn = void(*)(void*);
+
+	/// jR}h̕яL[iS^j
+	static constexpr ComponentType kDestroyOrder = 0xFFFFFFFFu;
+
+	struct Command
+	{
+		ComponentType order;    ///< яL[i^IDAj kDestroyOrderj
+		std::uint32_t seq;      ///< L^
+		EntityId      entity;   ///< Ώ
+		ApplyFn       apply;    ///< Kp
+		ReleaseFn     release;  ///< payload ̉isvȂ nullptrj
+		void*         payload;  ///< Add ̒lȂ
+	};
+
+	void Push(ComponentType order, EntityId e, ApplyFn apply, ReleaseFn release, void* payload)
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		m_commands.push_back(Command{ order, static_cast<std::uint32_t>(m_commands.size()), e, apply, release, payload });
+	}
+
+private:
+	World& m_world;
+	std::vector<Command> m_commands;
+	mutable std::mutex m_mutex;
+	std::thread::id m_ownerThread;  ///< Create Ăł悢XbhiWorld Xbhj
+};
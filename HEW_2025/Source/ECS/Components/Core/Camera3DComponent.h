@@ -71,7 +71,7 @@ struct Camera3DComponent
     /** @brief gp郂[h */
     Mode mode = Mode::Orbit;
 
-    /** @brief Ǐ]Ώۂ̃GeBeBID (0 = ) */
+    /** @brief Ǐ]Ώۂ̃GeBeBID (0 = Bjς݂ World::IsAlive Ŕ) */
     EntityId target = 0;
 
     // Orbit pp[^
@@ -33,6 +33,10 @@ struct Collider2DComponent
     // trueȂ炱̃RC_[͓ȂiEǁj
     bool isStatic = false;
 
+    // isStatic ł System  Transform 𓮂́iȂǁj
+    // u[htF[Ył͓IRC_ƂĖt[U蕪
+    bool isKinematic = false;
+
     // ̃RC_[̒S Transform.position ǂꂾĂ邩
     // 2DȂ̂ X/Y g܂iftHg͌_j
     DirectX::XMFLOAT2 offset{ 0.0f, 0.0f };
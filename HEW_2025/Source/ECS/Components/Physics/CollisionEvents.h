@@ -1,38 +1,176 @@
 /*********************************************************************/
 /* @file   CollisionEvents.h
- * @brief  t[ŔՓˏ𒙂߂Ăobt@
+ * @brief  ڐGyAzAEnter/Stay/Exit 𔭍sobt@
  *
  * WorldAǂLłꏊɒuĂāA
- * 蔻Systempush_backA
+ * 蔻System BeginFrame  Add  EndFrame ̏ŏ݁A
  * System_[WSystemœǂށAƂɂ܂B
- * 
+ *
+ * yA (ID, 傫ID) 1AOt[ɂ
+ * Enter / Stay At[ɗȂ̂ Exit ܂B
+ * t[̐ڐG̓C̑gƂɂĂ̂ŁA
+ * uvC[ ~ Death][vǂށAƂgł܂B
+ *
  * @author E
  * @date   2025/11/11
  *********************************************************************/
 #pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include "ECS/ECS.h"
+#include "ECS/Components/Physics/PhysicsLayers.h"
+
+/// ڐG̒iKirbgőgݍ킹či荞݂Ɏgj
+enum ContactPhase : std::uint8_t
+{
+    CONTACT_ENTER = 1 << 0, ///< t[Gꂽ
+    CONTACT_STAY  = 1 << 1, ///< Ot[GꑱĂ
+    CONTACT_EXIT  = 1 << 2, ///< Ot[͐GĂt[͗ꂽi肪ꍇ܂ށj
+
+    CONTACT_TOUCHING = CONTACT_ENTER | CONTACT_STAY, ///< GĂ
+    CONTACT_ALL      = CONTACT_ENTER | CONTACT_STAY | CONTACT_EXIT,
+};
 
 struct CollisionEvent
 {
-    EntityId self;     ///< 
-    EntityId other;    ///< Ԃ
-    bool     trigger;  ///< gK[ǂ
+    EntityId           self;       ///< 
+    EntityId           other;      ///< Ԃ
+    Physics::LayerMask selfLayer;  ///< ̃C
+    Physics::LayerMask otherLayer; ///< ̃C
+    bool               trigger;    ///< gK[ǂ
+    ContactPhase       phase;      ///< Enter / Stay / Exit
 };
 
 struct CollisionEventBuffer
 {
+    /// t[̐ڐGiself < other 1yA1BExit ܂ށj
     std::vector<CollisionEvent> events;
 
+    /// t[̎n߂ɌĂԁit[̈ꗗɂBz̃yA͎cj
+    void BeginFrame()
+    {
+        ++m_frame;
+        events.clear();
+        for (auto& kv : m_buckets)
+        {
+            kv.second.clear();
+        }
+    }
+
+    /// dȂĂyAǉiyA1t[2ȂƁj
+    void Add(EntityId a, Physics::LayerMask layerA, EntityId b, Physics::LayerMask layerB, bool trigger)
+    {
+        if (b < a)
+        {
+            std::swap(a, b);
+            std::swap(layerA, layerB);
+        }
+
+        auto inserted = m_pairs.try_emplace(PairKey(a, b));
+        PairState& st = inserted.first->second;
+        const bool wasTouching = !inserted.second;
+        st.layerA = layerA;
+        st.layerB = layerB;
+        st.trigger = trigger;
+        st.lastFrame = m_frame;
+
+        Push(CollisionEvent{ a, b, layerA, layerB, trigger, wasTouching ? CONTACT_STAY : CONTACT_ENTER });
+    }
+
+    /// t[̏IɌĂԁit[ɗȂyA Exit ɂĎ̂Ăj
+    void EndFrame()
+    {
+        for (auto it = m_pairs.begin(); it != m_pairs.end();)
+        {
+            const PairState& st = it->second;
+            if (st.lastFrame == m_frame)
+            {
+                ++it;
+                continue;
+            }
+            const EntityId a = static_cast<EntityId>(it->first >> 32);
+            const EntityId b = static_cast<EntityId>(it->first & 0xFFFFFFFFu);
+            Push(CollisionEvent{ a, b, st.layerA, st.layerB, st.trigger, CONTACT_EXIT });
+            it = m_pairs.erase(it);
+        }
+    }
+
+    /// z܂߂đSYiV[؂ւȂǁBExit ͏oȂj
     void Clear()
     {
-		/// Փ˃CxgNA
         events.clear();
+        m_buckets.clear();
+        m_pairs.clear();
+    }
+
+    /**
+     * @brief C̑g (selfLayer, otherLayer) ̍t[̐ڐG
+     * @param phases iKiCONTACT_ENTER ȂǁB͍GẮj
+     * @param fn void(const CollisionEvent&)Bev.self  selfLayer ɂȂ悤𑵂ēn
+     * @details RC_ layer 1rbgz肵AC̒lv̂E
+     */
+    template<class Fn>
+    void ForEachContact(Physics::LayerMask selfLayer, Physics::LayerMask otherLayer, Fn&& fn,
+        std::uint8_t phases = CONTACT_TOUCHING) const
+    {
+        auto found = m_buckets.find(BucketKey(selfLayer, otherLayer));
+        if (found == m_buckets.end())
+        {
+            return;
+        }
+        for (const std::uint32_t i : found->second)
+        {
+            const CollisionEvent& ev = events[i];
+            if ((ev.phase & phases) == 0) continue;
+
+            // Cm̑g͗n
+            if (ev.selfLayer == selfLayer)
+            {
+                fn(ev);
+            }
+            if (ev.otherLayer == selfLayer)
+            {
+                fn(CollisionEvent{ ev.other, ev.self, ev.otherLayer, ev.selfLayer, ev.trigger, ev.phase });
+            }
+        }
+    }
+
+    /// z̃yAiGẮj
+    std::size_t GetPairCount() const { return m_pairs.size(); }
+
+private:
+    struct PairState
+    {
+        Physics::LayerMask layerA = 0;
+        Physics::LayerMask layerB = 0;
+        bool               trigger = false;
+        std::uint32_t      lastFrame = 0;
+    };
+
+    static std::uint64_t PairKey(EntityId a, EntityId b)
+    {
+        return (static_cast<std::uint64_t>(a) << 32) | b;
     }
 
-    void Add(EntityId a, EntityId b, bool trigger)
+    static std::uint64_t BucketKey(Physics::LayerMask x, Physics::LayerMask y)
     {
-		/// Փ˃Cxgǉ
-        events.push_back(CollisionEvent{ a, b, trigger });
+        if (y < x) std::swap(x, y);
+        return (static_cast<std::uint64_t>(x) << 32) | y;
     }
+
+    void Push(const CollisionEvent& ev)
+    {
+        m_buckets[BucketKey(ev.selfLayer, ev.otherLayer)].push_back(static_cast<std::uint32_t>(events.size()));
+        events.push_back(ev);
+    }
+
+private:
+    /// z̃yAiL[ (ID << 32) | 傫IDj
+    std::unordered_map<std::uint64_t, PairState> m_pairs;
+    /// C̑g  events ̔ԍ
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_buckets;
+    /// BeginFrame Ƃɐi
+    std::uint32_t m_frame = 0;
 };
@@ -6,10 +6,110 @@
  * @date   2025/11/13
  *********************************************************************/
 #pragma once
+#include <limits>
 #include <DirectXMath.h>
 #include "ECS/Components/Physics/TransformComponent.h"
 #include "ECS/Components/Physics/Collider2DComponent.h"
 
+/**
+ * @brief [hWł2D AABBiŏ/őj
+ */
+struct WorldAabb2D
+{
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+};
+
+/**
+ * @brief Transform  Collider  [hW AABB 
+ */
+inline WorldAabb2D MakeWorldAabb(const TransformComponent& t, const Collider2DComponent& c)
+{
+    const float cx = t.position.x + c.offset.x;
+    const float cy = t.position.y + c.offset.y;
+    return WorldAabb2D{ cx - c.aabb.halfX, cy - c.aabb.halfY, cx + c.aabb.halfX, cy + c.aabb.halfY };
+}
+
+/**
+ * @brief [hW AABB m̏dȂ蔻iڂĂ邾Ȃ falsej
+ */
+inline bool IsAabbOverlap(const WorldAabb2D& a, const WorldAabb2D& b)
+{
+    return (a.minX < b.maxX) && (a.maxX > b.minX) && (a.minY < b.maxY) && (a.maxY > b.minY);
+}
+
+/**
+ * @brief  AABB ~܂Ă AABB ɓ鎞߂iXC[vj
+ *
+ * @param a ̊Jn AABB
+ * @param dx, dy ̊Ԃ̈ړ
+ * @param b ~܂Ă鑤 AABB
+ * @param outT iړʂɑ΂銄 0`1j
+ * @param outNx, outNy  b ̖ʂ̖@iOBǂ炩 }1A 0j
+ * @return ړ̓rœ trueBJn_ŏdȂĂ̂ falsei߂ɔCj
+ */
+inline bool SweepAabb(const WorldAabb2D& a, float dx, float dy, const WorldAabb2D& b,
+    float& outT, float& outNx, float& outNy)
+{
+    if (IsAabbOverlap(a, b))
+    {
+        return false;
+    }
+
+    constexpr float kInf = std::numeric_limits<float>::infinity();
+
+    // ƂɁudȂn߂鎞vƁudȂI鎞vo
+    float enterX = -kInf, exitX = kInf;
+    if (dx != 0.0f)
+    {
+        const float t0 = (b.minX - a.maxX) / dx;
+        const float t1 = (b.maxX - a.minX) / dx;
+        enterX = (t0 < t1) ? t0 : t1;
+        exitX = (t0 < t1) ? t1 : t0;
+    }
+    else if (a.maxX <= b.minX || a.minX >= b.maxX)
+    {
+        return false;
+    }
+
+    float enterY = -kInf, exitY = kInf;
+    if (dy != 0.0f)
+    {
+        const float t0 = (b.minY - a.maxY) / dy;
+        const float t1 = (b.maxY - a.minY) / dy;
+        enterY = (t0 < t1) ? t0 : t1;
+        exitY = (t0 < t1) ? t1 : t0;
+    }
+    else if (a.maxY <= b.minY || a.minY >= b.maxY)
+    {
+        return false;
+    }
+
+    // ŏdȂĂ鎞ԂΓ
+    const float enter = (enterX > enterY) ? enterX : enterY;
+    const float exit = (exitX < exitY) ? exitX : exitY;
+    if (enter >= exit || enter < 0.0f || enter > 1.0f)
+    {
+        return false;
+    }
+
+    outT = enter;
+    // xdȂn߂̖ʂɓiȂcD悵Ēnɂj
+    if (enterX > enterY)
+    {
+        outNx = (dx > 0.0f) ? -1.0f : 1.0f;
+        outNy = 0.0f;
+    }
+    else
+    {
+        outNx = 0.0f;
+        outNy = (dy > 0.0f) ? -1.0f : 1.0f;
+    }
+    return true;
+}
+
 /**
  * @brief 2D AABBm̏dȂ蔻
  *
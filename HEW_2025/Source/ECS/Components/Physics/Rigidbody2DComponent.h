@@ -4,8 +4,13 @@
  *
  * ł́ȗxvũt[ő́vuʁvud͂󂯂邩v
  * ȂǂĂ܂BړɏƂ͂ɉZ邾ōςނ悤ɁB
+ *
+ * ~܂܂܈t[o{fB PhysicsStepSystem 点A
+ * ϕ߂ȂȂ܂Bx͂ETransform 𓮂E
+ * Gn߂/ÂǂꂩŎIɋN܂B
  *********************************************************************/
 #pragma once
+#include <cstdint>
 #include <DirectXMath.h>
 
 struct Rigidbody2DComponent
@@ -15,4 +20,15 @@ struct Rigidbody2DComponent
     float mass = 1.0f;                                ///< ʁB0(=)ɂ瓮ȂłOK
     bool  useGravity = true;                          ///< d͂󂯂邩
     bool  onGround = false;                           ///< ɂ锻iWvȂǂŎgj
+
+    bool          allowSleep = true;  ///< ~܂Ă疰点Ă悢
+    bool          isSleeping = false; ///< Ă邩iĂԂ onGround ̂܂܎cj
+    std::uint16_t restFrames = 0;     ///< ~܂Ăt[iPhysicsStepSystem j
+
+    /// IɋNiNシ܂Ȃ悤j
+    void WakeUp()
+    {
+        isSleeping = false;
+        restFrames = 0;
+    }
 };
@@ -14,7 +14,7 @@
  */
 struct FollowerComponent
 {
-	EntityId targetId = 0;              // Ǐ]Ώۂ̃GeBeBID
+	EntityId targetId = 0;              // Ǐ]Ώۂ̃GeBeBIDijς݂ World::IsAlive Ŕj
 	DirectX::XMFLOAT2 offset{0.0f,0.0f}; // Ǐ]ɉZXYItZbgiUIʒuȂǁj
 };
 
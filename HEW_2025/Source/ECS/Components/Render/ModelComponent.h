@@ -10,6 +10,7 @@
 #include <array>
 #include "System/AssetManager.h"
 #include "System/Model.h"
+#include "System/AnimationInstance.h"
 
  /**
   * @brief 3Df`悷邽߂̏
@@ -18,11 +19,14 @@
   */
 struct ModelRendererComponent
 {
-    AssetHandle<Model> model;  ///< `悷郂f
+    AssetHandle<Model> model;  ///< `悷郂fiLBAj[V̏Ԃ ModelAnimationComponent j
     AssetHandle<Texture> baseTexture;      // 1P/2P̐FႢp
     AssetHandle<Texture> overrideTexture;  // \piȂ baseTexture or fftHgj
     bool visible = true;
 
+    /// ݒ肷ƃf̒_VF[_̑ɎgiLf̃VF[_ɍςށj
+    VertexShader* vertexShader = nullptr;
+
     DirectX::XMFLOAT3 localOffset{ 0.f,0.f,0.f };
 	DirectX::XMFLOAT3 localRotationDeg{ 0.f,0.f,0.f };
 	DirectX::XMFLOAT3 localScale{ 1.f,1.f,1.f };
@@ -43,7 +47,8 @@ struct ModelRendererComponent
  * @details
  * - ̃VXeí^ԑJڂȂǁj animeNo / loop / speed ݒ肵A
  *   playRequested  true ɂB
- * - ModelAnimationSystem Ď Model::Play ĂсAt[ Step B
+ * - ModelAnimationSystem Ď AnimationInstance::Play ĂсAt[ Step B
+ * - ĐԂƍ̎p instance ̂ŁA Model 𕡐̃GeBeBŋLłB
  */
 struct ModelAnimationComponent
 {
@@ -56,8 +61,11 @@ struct ModelAnimationComponent
     /// ĐxiModel::Play  speed ɂ̂܂ܓnj
     float speed = 1.0f;
 
-    /// true ̃t[ Model::Play() Ă
+    /// true ̃t[ AnimationInstance::Play() Ă
     bool  playRequested = false;
+
+    /// ̃GeBeB̍ĐԁiModelRendererComponent::model ɌѕtĎgj
+    AnimationInstance instance;
 };
 
 /**
@@ -8,27 +8,120 @@
 #pragma once
 
 #include <cstdint>
-#include <typeindex>
-#include <unordered_map>
+#include <cstddef>
+#include <atomic>
 #include <memory>
 
  /**
   * @brief GeBeBID^
   * @details
-  * GeBeB͒PȂ鐮IDƂĈ܂B
-  * 0 ͖lƂė\񂵂Ă܂B
+  *  kEntityIndexBits rbgXbgԍAʃrbg(o[W)łB
+  * jꂽXbg͐1i߂čėp邽߁A
+  * ÂID܂܂ł World::IsAlive()  O(1) ɖoł܂B
+  * 0 (Xbg0E0) ͖lƂė\񂵂Ă܂B
   */
 using EntityId = std::uint32_t;
 
 /// GeBeB萔
 constexpr EntityId kInvalidEntity = 0;
 
+/// XbgԍɎgrbgiő100GeBeBj
+constexpr std::uint32_t kEntityIndexBits = 20;
+/// Xbgԍ̃}XN
+constexpr EntityId kEntityIndexMask = (EntityId{ 1 } << kEntityIndexBits) - 1;
+/// 㕔̃}XNiVtgj
+constexpr std::uint32_t kEntityVersionMask = (std::uint32_t{ 1 } << (32 - kEntityIndexBits)) - 1;
+
+/// IDXbgԍo
+constexpr std::uint32_t EntityIndex(EntityId e) { return e & kEntityIndexMask; }
+/// ID琢o
+constexpr std::uint32_t EntityVersion(EntityId e) { return e >> kEntityIndexBits; }
+/// XbgԍƐォIDgݗĂ
+constexpr EntityId MakeEntityId(std::uint32_t index, std::uint32_t version)
+{
+	return ((version & kEntityVersionMask) << kEntityIndexBits) | (index & kEntityIndexMask);
+}
+
+/// 1 World ɓo^łR|[lg^̍ő吔
+constexpr std::size_t kMaxComponentTypes = 128;
+
+/**
+ * @brief GeBeBĂR|[lg^̏Wirbg}XNj
+ * @details
+ * rbgԍ ComponentFamily::Id<T>() łB
+ * Destroy ͂ɗĂrbg̃Xg[WG܂B
+ */
+class ComponentMask
+{
+public:
+	void Set(std::size_t bit) { m_words[bit / 64] |= (std::uint64_t{ 1 } << (bit % 64)); }
+	void Reset(std::size_t bit) { m_words[bit / 64] &= ~(std::uint64_t{ 1 } << (bit % 64)); }
+	bool Test(std::size_t bit) const { return (m_words[bit / 64] >> (bit % 64)) & 1u; }
+	void Clear() { for (auto& w : m_words) { w = 0; } }
+
+	/// other ̃rbgׂĊ܂ł邩
+	bool ContainsAll(const ComponentMask& other) const
+	{
+		for (std::size_t i = 0; i < kWordCount; ++i)
+		{
+			if ((m_words[i] & other.m_words[i]) != other.m_words[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// ĂrbgԍƂ fn(bit) Ă
+	template <class Fn>
+	void ForEach(Fn&& fn) const
+	{
+		for (std::size_t i = 0; i < kWordCount; ++i)
+		{
+			std::uint64_t w = m_words[i];
+			for (std::size_t b = 0; w != 0; ++b, w >>= 1)
+			{
+				if (w & 1u)
+				{
+					fn(i * 64 + b);
+				}
+			}
+		}
+	}
+
+private:
+	static constexpr std::size_t kWordCount = kMaxComponentTypes / 64;
+	std::uint64_t m_words[kWordCount] = {};
+};
+
 /**
  * @brief R|[lǧ^ID\߂̃GCAX
  * @details
- * ł std::type_index L[ɂāA^Ƃ̃Xg[WЂƂ܂Ƃ߂ɊǗ܂B
+ * ComponentFamily ^Ƃɕo 0 n܂̘AԂłB
+ * World ͂̒l̂܂ܓYɂăXg[Wz܂B
+ */
+using ComponentType = std::uint32_t;
+
+/**
+ * @brief R|[lg^Ƃ̘AID𕥂oJE^
+ * @details
+ * ^Tɂď߂ Id<T>() Ă΂ꂽƂɔԍm肵Aȍ~͓lԂ܂B
+ * 2ڈȍ~͊֐ static ǂނȂ̂ŁAtype_index ̃nbVvZ͔܂B
+ * ԍ ComponentMask ̃rbgԍ˂܂B
  */
-using ComponentType = std::type_index;
+class ComponentFamily
+{
+public:
+	template <class T>
+	static ComponentType Id()
+	{
+		static const ComponentType id = s_next.fetch_add(1);
+		return id;
+	}
+
+private:
+	static inline std::atomic<ComponentType> s_next{ 0 };
+};
 
 /**
  * @brief eR|[lgXg[Wʂ̃C^[tF[X
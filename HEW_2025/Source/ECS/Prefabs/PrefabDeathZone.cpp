@@ -33,6 +33,7 @@ void RegisterDeathZonePrefab(PrefabRegistry& registry)
 		col.isTrigger = true;          // gK[ɂ
         // TCYscaleŒ
         world.Add<Collider2DComponent>(e, col);
+        world.Add<TagDynamicCollider>(e); // オĂ̂ŐÓIiqɍڂȂ
 
         // f`pR|[lgǉ
         std::string modelName = sp.modelAlias.empty() ? "mdl_deathzone" : sp.modelAlias;
@@ -11,6 +11,7 @@
 #include "ECS/Components/Physics/Collider2DComponent.h"
 #include "ECS/Components/Physics/PhysicsLayers.h"
 #include "ECS/Components/Render/ModelComponent.h"
+#include "ECS/Tag/Tag.h"
 #include "System/AssetManager.h"
 #include "System/DirectX/ShaderList.h"
 
@@ -35,12 +36,15 @@ void RegisterGoalPrefab(PrefabRegistry& registry)
 
             // Collider2D (AABB)
             auto& col = world.Add<Collider2DComponent>(e);
+            // LO[v(Transform+Collider2D)ɓ Transform  dense œ̂ň
+            const auto& trNow = world.Get<TransformComponent>(e);
             col.shape = ColliderShapeType::AABB2D;
-            col.aabb.halfX = tr.scale.x;
-            col.aabb.halfY = tr.scale.y;
+            col.aabb.halfX = trNow.scale.x;
+            col.aabb.halfY = trNow.scale.y;
             col.layer = Physics::LAYER_GOAL;
             col.hitMask = Physics::LAYER_PLAYER;
 			col.isTrigger = true; // 蔻̓gK[ɂ
+            world.Add<TagDynamicCollider>(e); // ÓIł͂Ȃ̂œIRC_ƂĈ
 
             // Model (ڂ͒nʂƓɂĂ)
             auto& mr = world.Add<ModelRendererComponent>(e);
@@ -13,6 +13,7 @@
 #include "ECS/Components/Physics/PhysicsLayers.h"
 #include "ECS/Components/Render/ModelComponent.h"
 #include "ECS/Components/Gimick/MovingPlatformComponent.h"
+#include "ECS/Tag/Tag.h"
 #include "System/AssetManager.h"
 #include "System/DirectX/ShaderList.h"
 
@@ -28,12 +29,16 @@ void RegisterMovingPlatformPrefab(PrefabRegistry& registry)
 
             // Collideriꁁnʈj
             auto& col = w.Add<Collider2DComponent>(e);
+            // LO[v(Transform+Collider2D)ɓ Transform  dense œ̂ň
+            const auto& trNow = w.Get<TransformComponent>(e);
             col.shape = ColliderShapeType::AABB2D;
-            col.aabb.halfX = tr.scale.x;
-            col.aabb.halfY = tr.scale.y;
+            col.aabb.halfX = trNow.scale.x;
+            col.aabb.halfY = trNow.scale.y;
             col.layer = Physics::LAYER_GROUND;
             col.hitMask = Physics::LAYER_PLAYER;
             col.isStatic = true; // Iɂ͐ÓI Transform VXeœi[Ll}eBbNj
+            col.isKinematic = true;
+            w.Add<TagDynamicCollider>(e); // Xebv̂ŐÓIiqɍڂȂ
 
             // 
             auto& mr = w.Add<ModelRendererComponent>(e);
@@ -49,8 +54,8 @@ void RegisterMovingPlatformPrefab(PrefabRegistry& registry)
 
             // p[^iftHg͐4jbgj
             auto& mp = w.Add<MovingPlatformComponent>(e);
-            mp.start = { tr.position.x, tr.position.y };
-            mp.end   = { tr.position.x + 4.0f, tr.position.y };
+            mp.start = { trNow.position.x, trNow.position.y };
+            mp.end   = { trNow.position.x + 4.0f, trNow.position.y };
             mp.speed = 2.0f;
             mp.waitTime = 0.0f;
 
@@ -72,9 +72,9 @@ void RegisterPlayerPrefab(PrefabRegistry& registry)
 			w.Add<PlayerStateComponent>(e);
 
             auto& mr = w.Add<ModelRendererComponent>(e);
-            // LLbVg킸AƗCX^X𐶐ăAjԂ̋Lh
+            // f͋LLbViAjԂ ModelAnimationComponent::instance GeBeBƂɎj
             const std::string modelAlias = sp.modelAlias.empty() ? std::string("mdl_2Pplayer") : sp.modelAlias;
-            mr.model = AssetManager::CreateModelInstance(modelAlias);
+            mr.model = AssetManager::GetModel(modelAlias);
             mr.localScale = { .7f, 0.35f, .7f }; // XP[
             mr.localOffset = { 0.f, -0.15f, 0.f }; // _ɍ킹
 			mr.localRotationDeg = { 0.f, 180.f, 0.f }; // f̌𒲐
@@ -90,7 +90,7 @@ void RegisterPlayerPrefab(PrefabRegistry& registry)
                 mr.baseTexture = AssetManager::GetTexture("tex_aousagi");
             }
 			
-            // ̃fCX^Xɑ΂ČʂɃAjǉ
+            // LfɃAjǉiǂݍݍς݂̃t@C͑O̔ԍԂj
             AnimeNo idleNo = Model::ANIME_NONE;
             AnimeNo runNo  = Model::ANIME_NONE;
             AnimeNo runLeftNo  = Model::ANIME_NONE;
@@ -247,13 +247,16 @@ void RegisterPlayerPrefab(PrefabRegistry& registry)
 
             // 蔻͑OƓ
             auto& col = w.Add<Collider2DComponent>(e);
+            // LO[v(Transform+Collider2D)ɓ Transform  dense œ̂ň
+            const auto& trNow = w.Get<TransformComponent>(e);
             col.shape = ColliderShapeType::AABB2D;
-            col.aabb.halfX = tr.scale.x;
-            col.aabb.halfY = tr.scale.y;
+            col.aabb.halfX = trNow.scale.x;
+            col.aabb.halfY = trNow.scale.y;
             col.layer = Physics::LAYER_PLAYER;
             col.hitMask = Physics::LAYER_GROUND || Physics::LAYER_GOAL;
             col.isStatic = false;
             col.offset = { 0.0f, 1.f };
+            w.Add<TagDynamicCollider>(e); // Xebv̂ŐÓIiqɍڂȂ
 
             return e;
         }
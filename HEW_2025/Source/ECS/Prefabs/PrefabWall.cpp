@@ -49,9 +49,11 @@ void RegisterWallPrefab(PrefabRegistry& registry)
 
 			/// FÓIȏ
             auto& col = w.Add<Collider2DComponent>(e);
+            // LO[v(Transform+Collider2D)ɓ Transform  dense œ̂ň
+            const auto& trNow = w.Get<TransformComponent>(e);
             col.shape = ColliderShapeType::AABB2D;
-            col.aabb.halfX = tr.scale.x;
-            col.aabb.halfY = tr.scale.y;
+            col.aabb.halfX = trNow.scale.x;
+            col.aabb.halfY = trNow.scale.y;
             col.layer = Physics::LAYER_GROUND;
             col.hitMask = Physics::LAYER_PLAYER;
             col.isStatic = true;
@@ -7,6 +7,7 @@
  *********************************************************************/
 #pragma once
 #include "../World.h"
+#include "SystemAccess.h"
 
  /**
   * @class IUpdateSystem
@@ -26,4 +27,12 @@ public:
 	 * @param[in] dt Ot[̌oߎԁibj
 	 */
 	virtual void Update(class World& world, float dt) = 0;
+
+	/**
+	 * @brief Systemǂݏf[^̐錾
+	 * @details
+	 * ͋irjŁASystemƂ͓Ɏs܂B
+	 * 錾Ƃ̖񑩎 SystemAccess QƂĂB
+	 */
+	virtual SystemAccess Access() const { return SystemAccess{}; }
 };
@@ -41,7 +41,7 @@ void CollisionDebugRenderSystem::Render(const World& world)
     Geometory::SetProjection(m_proj);
 
     // ׂẴRC_`
-    world.View<TransformComponent, Collider2DComponent>(
+    world.View<const TransformComponent, const Collider2DComponent>(
         [&](EntityId,
             const TransformComponent& tr,
             const Collider2DComponent& col)
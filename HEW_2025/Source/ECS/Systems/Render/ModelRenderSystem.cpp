@@ -26,9 +26,40 @@
 #include "System/DebugSettings.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
 
 using namespace DirectX;
 
+namespace
+{
+    /// ModelRenderer ̃[Jϊ Transform ]uς݃[hs
+    XMFLOAT4X4 BuildWorldMatrix(const TransformComponent& tr, const ModelRendererComponent& mr)
+    {
+        // ---------- [Jϊ ----------
+        const XMMATRIX LS = XMMatrixScaling(mr.localScale.x, mr.localScale.y, mr.localScale.z);
+        const XMMATRIX LRx = XMMatrixRotationX(XMConvertToRadians(mr.localRotationDeg.x));
+        const XMMATRIX LRy = XMMatrixRotationY(XMConvertToRadians(mr.localRotationDeg.y));
+        const XMMATRIX LRz = XMMatrixRotationZ(XMConvertToRadians(mr.localRotationDeg.z));
+        const XMMATRIX LT = XMMatrixTranslation(mr.localOffset.x, mr.localOffset.y, mr.localOffset.z);
+        const XMMATRIX L = LS * LRx * LRy * LRz * LT;
+
+        // ---------- GeBeBϊ ----------
+        const XMMATRIX S = XMMatrixScaling(tr.scale.x, tr.scale.y, tr.scale.z);
+        const XMMATRIX Rx = XMMatrixRotationX(XMConvertToRadians(tr.rotationDeg.x));
+        const XMMATRIX Ry = XMMatrixRotationY(XMConvertToRadians(tr.rotationDeg.y));
+        const XMMATRIX Rz = XMMatrixRotationZ(XMConvertToRadians(tr.rotationDeg.z));
+        const XMMATRIX T = XMMatrixTranslation(tr.position.x, tr.position.y, tr.position.z);
+        const XMMATRIX Wentity = S * Rx * Ry * Rz * T;
+
+        // ---------- ŏI[hϊ ----------
+        const XMMATRIX W = L * Wentity;
+        XMFLOAT4X4 worldT;
+        XMStoreFloat4x4(&worldT, XMMatrixTranspose(W));
+        return worldT;
+    }
+}
+
 //--------------------------------------------------------------
 // Render : f`揈
 //--------------------------------------------------------------
@@ -60,10 +91,30 @@ void ModelRenderSystem::Render(const World& world)
     );
 
     // =====================
-    // 2. fW (JOKp)
+    // 2. [hs̍XViO񂩂ύXꂽ̂j
     // =====================
+    // ÓIȃubN͐ɈxvZ΍ςނ̂ŁATransform / ModelRenderer 
+    // ǂ炩ύXꂽGeBeB蒼BǉύXɂȂ̂ŏEB
+    m_worldCache.resize(world.EntityCapacity());
+    const auto rebuild = [&](EntityId e, const TransformComponent& tr, const ModelRendererComponent& mr)
+        {
+            CachedWorld& c = m_worldCache[EntityIndex(e)];
+            c.entity = e;
+            c.world = BuildWorldMatrix(tr, mr);
+        };
+    world.ParallelView<const TransformComponent, const ModelRendererComponent>(Changed<TransformComponent>{ m_lastTick }, rebuild);
+    world.ParallelView<const TransformComponent, const ModelRendererComponent>(Changed<ModelRendererComponent>{ m_lastTick }, rebuild);
+    m_lastTick = world.CurrentTick();
+
+    // =====================
+    // 3. fW (JOKp)
+    // =====================
+    // W̓GeBeBƂɓƗĂ̂ŃWuv[ŕɍsB
+    // o͎͐Oɍő吔ԂmۂAatomic ŋ󂫃Xbg𕥂oB
     const bool skipCulling = DebugSettings::Get().gameDead; // o̓JO
-    world.View<TransformComponent, ModelRendererComponent>(
+    m_modelList.resize(world.Count<TransformComponent, ModelRendererComponent>());
+    std::atomic<std::size_t> modelCount{ 0 };
+    world.ParallelView<const TransformComponent, const ModelRendererComponent>(
         [&](EntityId e, const TransformComponent& tr, const ModelRendererComponent& mr)
         {
             if (!mr.visible || !mr.model)
@@ -87,26 +138,8 @@ void ModelRenderSystem::Render(const World& world)
                 }
             }
 
-            // ---------- [Jϊ ----------
-            const XMMATRIX LS = XMMatrixScaling(mr.localScale.x, mr.localScale.y, mr.localScale.z);
-            const XMMATRIX LRx = XMMatrixRotationX(XMConvertToRadians(mr.localRotationDeg.x));
-            const XMMATRIX LRy = XMMatrixRotationY(XMConvertToRadians(mr.localRotationDeg.y));
-            const XMMATRIX LRz = XMMatrixRotationZ(XMConvertToRadians(mr.localRotationDeg.z));
-            const XMMATRIX LT = XMMatrixTranslation(mr.localOffset.x, mr.localOffset.y, mr.localOffset.z);
-            const XMMATRIX L = LS * LRx * LRy * LRz * LT;
-
-            // ---------- GeBeBϊ ----------
-            const XMMATRIX S = XMMatrixScaling(tr.scale.x, tr.scale.y, tr.scale.z);
-            const XMMATRIX Rx = XMMatrixRotationX(XMConvertToRadians(tr.rotationDeg.x));
-            const XMMATRIX Ry = XMMatrixRotationY(XMConvertToRadians(tr.rotationDeg.y));
-            const XMMATRIX Rz = XMMatrixRotationZ(XMConvertToRadians(tr.rotationDeg.z));
-            const XMMATRIX T = XMMatrixTranslation(tr.position.x, tr.position.y, tr.position.z);
-            const XMMATRIX Wentity = S * Rx * Ry * Rz * T;
-
-            // ---------- ŏI[hϊ ----------
-            const XMMATRIX W = L * Wentity;
-            XMFLOAT4X4 worldT;
-            XMStoreFloat4x4(&worldT, XMMatrixTranspose(W));
+            const CachedWorld& cached = m_worldCache[EntityIndex(e)];
+            assert(cached.entity == e && "ModelRenderSystem: world matrix cache is stale");
 
             AssetHandle<Texture> texHandle;
 
@@ -127,24 +160,32 @@ void ModelRenderSystem::Render(const World& world)
                 else if (mr.baseTexture)     texHandle = mr.baseTexture;
             }
 
+            // Aj[V̂́ÃGeBeB̎pŕ`
+            const auto* anim = world.TryGet<ModelAnimationComponent>(e);
+
             // ---------- Xgւ̒ǉ ----------
-            m_modelList.push_back(SortableModel{
+            m_modelList[modelCount.fetch_add(1, std::memory_order_relaxed)] = SortableModel{
                 mr.layer,
-                worldT,
+                e,
+                cached.world,
                 mr.model.get(),
-                texHandle
-                });
+                texHandle,
+                anim ? &anim->instance : nullptr,
+                mr.vertexShader
+                };
         });
+    m_modelList.resize(modelCount.load());
 
     // =====================
-    // 3. \[g & `
+    // 4. \[g & `
     // =====================
     std::sort(
         m_modelList.begin(),
         m_modelList.end(),
         [](const SortableModel& a, const SortableModel& b)
         {
-            return a.layer < b.layer;
+            // WŏԂsɂȂ邽߁AꃌC[̓GeBeBIDŌŒ肷
+            return (a.layer != b.layer) ? (a.layer < b.layer) : (a.entity < b.entity);
         });
 
     XMFLOAT4X4 wvp[3];
@@ -161,10 +202,10 @@ void ModelRenderSystem::Render(const World& world)
 
         // I[o[CheNX`tŕ`
         Texture* texPtr = s.overrideTexture ? s.overrideTexture.get() : nullptr;
-        s.model->Draw(-1, texPtr);
+        s.model->Draw(-1, texPtr, s.pose, s.vertexShader);
 
 //#ifdef _DEBUG
-//        s.model->DrawBone();
+//        s.model->DrawBone(s.pose);
 //#endif
     }
 
@@ -67,15 +67,32 @@ private:
     {
         // \[gpL[
         int layer; // <ModelRendererComponent::layer
+        EntityId entity; // ꃌC[̕тŒ肷邽߂̕L[
 
         // `pf[^
         DirectX::XMFLOAT4X4 world; // [hs(Transposeς)
         Model* model;              // fnh
         AssetHandle<Texture> overrideTexture; // keep shared_ptr alive for the frame
+        const AnimationInstance* pose;  // ̎piAj[VȂ̂ nullptrj
+        VertexShader* vertexShader;     // GeBeB̒_VF[_winullptr Ȃ烂f̐ݒj
     };
 
     // `惊Xg(t[g܂킷)
     std::vector<SortableModel>m_modelList;
+
+    /**
+     * @brief GeBeBƂ̃[hsLbViY = EntityIndexj
+     * @details Transform  ModelRenderer ύXꂽGeBeB蒼
+     */
+    struct CachedWorld
+    {
+        EntityId entity = kInvalidEntity;   ///< vZ̎iXbgėp̌opj
+        DirectX::XMFLOAT4X4 world{};        ///< [hs(Transposeς)
+    };
+    std::vector<CachedWorld> m_worldCache;
+
+    /// O Render  World eBbNi̕ύXs蒼j
+    std::uint32_t m_lastTick = 0;
 };
 
 
@@ -52,7 +52,7 @@ void TimerSystem::Update(World& world, float dt)
 	DirectX::XMFLOAT3 camPos = { 0.0f, 0.0f, 0.0f };
 	bool foundCamera = false;
 
-	world.View<ActiveCameraTag, TransformComponent>(
+	world.View<const ActiveCameraTag, const TransformComponent>(
 		[&](EntityId, const ActiveCameraTag&, const TransformComponent& tr)
 		{
 			camPos = tr.position;
@@ -64,7 +64,7 @@ void TimerSystem::Update(World& world, float dt)
 	float sizeTexX = 1.0f / (float)ANIM_SCORE_SPLITE_X;
 	float sizeTexY = 1.0f / (float)ANIM_SCORE_SPLITE_Y;
 
-	world.View<DigitUIComponent, Sprite2DComponent, TransformComponent>(
+	world.View<const DigitUIComponent, Sprite2DComponent, TransformComponent>(
 		[&](EntityId, const DigitUIComponent& digit, Sprite2DComponent& sprite, TransformComponent&tr)
 		{
 			//-----\鐔-----
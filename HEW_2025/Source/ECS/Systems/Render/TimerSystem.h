@@ -9,9 +9,23 @@
 #include "ECS/Systems/IUpdateSystem.h"
 #include "ECS/World.h"
 #include "ECS/Components/Render/DigitUIComponent.h"
+#include "ECS/Components/Render/Sprite2DComponent.h"
+#include "ECS/Components/Physics/TransformComponent.h"
+#include "ECS/Components/Core/ActiveCameraTag.h"
+#include "System/TimeAttackManager.h"
 
 class TimerSystem : public IUpdateSystem
 {
 public:
 	void Update(World& world, float dt) override;
+
+	// ^Cvi߁AJʒuǂŐUI Sprite/Transform 
+	SystemAccess Access() const override
+	{
+		return SystemAccess{}
+			.Resource<TimeAttackManager>()
+			.Read<ActiveCameraTag>()
+			.ReadIn<ActiveCameraTag, TransformComponent>()
+			.WriteIn<DigitUIComponent, DigitUIComponent, Sprite2DComponent, TransformComponent>();
+	}
 };
\ No newline at end of file
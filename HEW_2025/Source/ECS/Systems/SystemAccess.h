@@ -0,0 +1,139 @@
+/*****************************************************************//**
+ * @file   SystemAccess.h
+ * @brief  UpdatenSystemGf[^(R|[lg/L\[X)̐錾
+ *
+ * SystemRegistry ͂̐錾m̏Փ˂SystemԂ̈ˑ(DAG)A
+ * Փ˂ȂSystem JobSystem œɎs܂B
+ *
+ * @author E
+ * @date   2025/11/11
+ *********************************************************************/
+#pragma once
+
+#include "ECS/ECS.h"
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class SystemAccess
+ * @brief System ̓ǂݏΏۂ̈ꗗ
+ * @details
+ * - 錾Ȃ()ꍇ́urvɂȂȂSSystemƏՓ˂܂B
+ *   錾𑫂ĂȂSystem͏]ǂo^1s܂B
+ * - Read/Write ͌^TSGeBeBΏۂłB
+ * - ReadIn/WriteIn ́uScope GeBeB T vG邱Ƃ\܂B
+ *   Scope قȂ錾m͕ʃGeBeBGƂ݂ȂďՓ˂܂
+ *   i: DigitUIComponent t Transform  BackGroundScrollComponent t TransformjB
+ *   1̃GeBeBɗ Scope t\ꍇ Scope ȂŐ錾ĂB
+ * - Resource<R>() ̓VOg̋L R 邱Ƃ\܂B
+ *
+ * 錾SysteḿASystemƓɑĂSł邱ƂOłB
+ * - 錾ÕR|[lg⋤LԂɐGȂ
+ * - ǂނ̃R|[lg View<const T> / const World& oRŎ擾iύXeBbNȂj
+ * - Destroy/Add/Remove  world.Commands() ɐςށBCreate ̓[J[ĂׂȂ̂ŎgȂiCommands().Create() sj
+ */
+class SystemAccess
+{
+public:
+	/// T SGeBeBɂēǂ
+	template <class... Ts>
+	SystemAccess& Read()
+	{
+		(Push(ComponentFamily::Id<Ts>(), kAnyScope, Kind::Read), ...);
+		return *this;
+	}
+
+	/// T SGeBeBɂď
+	template <class... Ts>
+	SystemAccess& Write()
+	{
+		(Push(ComponentFamily::Id<Ts>(), kAnyScope, Kind::Write), ...);
+		return *this;
+	}
+
+	/// Scope GeBeB T ǂ
+	template <class Scope, class... Ts>
+	SystemAccess& ReadIn()
+	{
+		(Push(ComponentFamily::Id<Ts>(), ComponentFamily::Id<Scope>(), Kind::Read), ...);
+		return *this;
+	}
+
+	/// Scope GeBeB T 
+	template <class Scope, class... Ts>
+	SystemAccess& WriteIn()
+	{
+		(Push(ComponentFamily::Id<Ts>(), ComponentFamily::Id<Scope>(), Kind::Write), ...);
+		return *this;
+	}
+
+	/// L R i R 錾Systemm͓ɑȂj
+	template <class R>
+	SystemAccess& Resource()
+	{
+		Push(ResourceId<R>(), kAnyScope, Kind::Resource);
+		return *this;
+	}
+
+	/// 錾ĂȂirj
+	bool IsExclusive() const { return m_entries.empty(); }
+
+	/// other ƓɎsƊ댯
+	bool ConflictsWith(const SystemAccess& other) const
+	{
+		if (IsExclusive() || other.IsExclusive())
+		{
+			return true;
+		}
+
+		for (const Entry& a : m_entries)
+		{
+			for (const Entry& b : other.m_entries)
+			{
+				if (a.id != b.id || (a.kind == Kind::Resource) != (b.kind == Kind::Resource))
+				{
+					continue;
+				}
+				if (a.kind == Kind::Read && b.kind == Kind::Read)
+				{
+					continue;
+				}
+				if (a.scope == kAnyScope || b.scope == kAnyScope || a.scope == b.scope)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+private:
+	enum class Kind : std::uint8_t { Read, Write, Resource };
+
+	/// Scope wȂ
+	static constexpr ComponentType kAnyScope = 0xFFFFFFFFu;
+
+	struct Entry
+	{
+		ComponentType id;    ///< R|[lg^IDiResource ̂Ƃ̓\[XIDj
+		ComponentType scope; ///< Ώۂi^IDikAnyScope ȂSGeBeBj
+		Kind          kind;
+	};
+
+	void Push(ComponentType id, ComponentType scope, Kind kind)
+	{
+		m_entries.push_back(Entry{ id, scope, kind });
+	}
+
+	/// L\[Xp̘AԁiR|[lǧ^IDƂ͕ʌnj
+	template <class R>
+	static ComponentType ResourceId()
+	{
+		static const ComponentType id = s_nextResource.fetch_add(1);
+		return id;
+	}
+
+	static inline std::atomic<ComponentType> s_nextResource{ 0 };
+
+	std::vector<Entry> m_entries;
+};
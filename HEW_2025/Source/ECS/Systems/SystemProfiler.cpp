@@ -0,0 +1,135 @@
+/*****************************************************************//**
+ * @file   SystemProfiler.cpp
+ * @brief  System Ƃ̏ԏWv̎
+ *
+ * @author E
+ * @date   2025/11/11
+ *********************************************************************/
+#include "SystemProfiler.h"
+#include "libs/nlohmann/json.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+using json = nlohmann::json;
+
+std::size_t SystemProfiler::Register(const std::string& name, Phase phase)
+{
+    for (std::size_t i = 0; i < m_stats.size(); ++i)
+    {
+        if (m_stats[i]->name == name && m_stats[i]->phase == phase)
+        {
+            return i;
+        }
+    }
+
+    auto stats = std::make_unique<Stats>();
+    stats->name = name;
+    stats->phase = phase;
+    m_stats.push_back(std::move(stats));
+    return m_stats.size() - 1;
+}
+
+void SystemProfiler::Record(std::size_t id, double ms)
+{
+    Stats& s = *m_stats[id];
+
+    // ߃EBhEiOobt@j
+    const double evicted = s.ring[s.ringHead];
+    s.ringSum += ms - evicted;
+    s.ring[s.ringHead] = ms;
+    s.ringHead = (s.ringHead + 1) % kWindow;
+    ++s.samples;
+
+    const std::size_t filled = static_cast<std::size_t>(std::min<std::uint64_t>(s.samples, kWindow));
+    s.lastMs = ms;
+    s.avgMs = s.ringSum / static_cast<double>(filled);
+    // ő͎񂵁Aolő傾Ƃrߒ
+    if (ms >= s.maxMs)
+    {
+        s.maxMs = ms;
+    }
+    else if (evicted >= s.maxMs)
+    {
+        s.maxMs = *std::max_element(s.ring.begin(), s.ring.begin() + filled);
+    }
+    s.peakMs = std::max(s.peakMs, ms);
+
+    // qXgO
+    const auto bin = std::lower_bound(kBinUpperMs.begin(), kBinUpperMs.end(), ms) - kBinUpperMs.begin();
+    ++s.histogram[static_cast<std::size_t>(bin)];
+}
+
+void SystemProfiler::Reset()
+{
+    for (auto& s : m_stats)
+    {
+        const std::string name = s->name;
+        const Phase phase = s->phase;
+        *s = Stats{};
+        s->name = name;
+        s->phase = phase;
+    }
+}
+
+const char* SystemProfiler::PhaseName(Phase phase)
+{
+    switch (phase)
+    {
+    case Phase::Update: return "Update";
+    case Phase::Render: return "Render";
+    case Phase::Frame:  return "Frame";
+    }
+    return "?";
+}
+
+bool SystemProfiler::DumpCsv(const std::string& path) const
+{
+    std::ofstream ofs(path, std::ios::out | std::ios::trunc);
+    if (!ofs) return false;
+
+    ofs << "name,phase,samples,lastMs,avgMs,maxMs,peakMs";
+    for (std::size_t b = 0; b < kHistogramBins; ++b)
+    {
+        if (b < kBinUpperMs.size()) ofs << ",le" << kBinUpperMs[b] << "ms";
+        else                        ofs << ",over";
+    }
+    ofs << "\n";
+
+    for (const auto& s : m_stats)
+    {
+        ofs << s->name << ',' << PhaseName(s->phase) << ',' << s->samples << ','
+            << s->lastMs << ',' << s->avgMs << ',' << s->maxMs << ',' << s->peakMs;
+        for (std::uint64_t count : s->histogram)
+        {
+            ofs << ',' << count;
+        }
+        ofs << "\n";
+    }
+    return static_cast<bool>(ofs);
+}
+
+bool SystemProfiler::DumpJson(const std::string& path) const
+{
+    json j;
+    j["binUpperMs"] = kBinUpperMs;
+    j["systems"] = json::array();
+    for (const auto& s : m_stats)
+    {
+        j["systems"].push_back({
+            { "name", s->name },
+            { "phase", PhaseName(s->phase) },
+            { "samples", s->samples },
+            { "lastMs", s->lastMs },
+            { "avgMs", s->avgMs },
+            { "maxMs", s->maxMs },
+            { "peakMs", s->peakMs },
+            { "histogram", s->histogram },
+        });
+    }
+
+    std::ofstream ofs(path, std::ios::out | std::ios::trunc);
+    if (!ofs) return false;
+    ofs << j.dump(2);
+    return static_cast<bool>(ofs);
+}
@@ -0,0 +1,117 @@
+/*****************************************************************//**
+ * @file   SystemProfiler.h
+ * @brief  System Ƃ̏ԂWvvt@C
+ *
+ * SystemRegistry  Tick()/Render() ̒Ŋe System ̎sԂ𑪂A֋L^܂B
+ * Wv̓VXei^jPʂȂ̂ŁAV[؂ւĂ System ̓v͌p܂B
+ * ImGui  "Debug Settings" EBhE "System Profiler" ŊmFłA
+ * DumpCsv()/DumpJson() ŃrhԂ̔rpɏo܂B
+ *
+ * @author E
+ * @date   2025/11/11
+ *********************************************************************/
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class SystemProfiler
+ * @brief System Pʂ̏ԓviߕρEőEqXgOjێVOg
+ */
+class SystemProfiler
+{
+public:
+    /// ߕ/ő̑Ώۂɂt[
+    static constexpr std::size_t kWindow = 120;
+    /// qXgÕriŌ̃r͏j
+    static constexpr std::size_t kHistogramBins = 12;
+    /// qXgO̊eȑ[ms]ikHistogramBins - 1 j
+    static constexpr std::array<double, kHistogramBins - 1> kBinUpperMs = {
+        0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0
+    };
+
+    /// v敪
+    enum class Phase : std::uint8_t
+    {
+        Update,  ///< IUpdateSystem
+        Render,  ///< IRenderSystem
+        Frame,   ///< Tick/Render S
+    };
+
+    /// 1 System ̓v
+    struct Stats
+    {
+        std::string name;
+        Phase       phase = Phase::Update;
+
+        std::uint64_t samples = 0;     ///< L^
+        double lastMs = 0.0;           ///< ŐVl
+        double avgMs = 0.0;            ///<  kWindow ̕
+        double maxMs = 0.0;            ///<  kWindow ̍ő
+        double peakMs = 0.0;           ///< Reset ȍ~̍ő
+        std::array<std::uint64_t, kHistogramBins> histogram{}; ///< Reset ȍ~̕z
+
+        std::array<double, kWindow> ring{}; ///< ߂̒l
+        std::size_t ringHead = 0;
+        double ringSum = 0.0;
+    };
+
+    /// vɎgv
+    using Clock = std::chrono::steady_clock;
+
+    static SystemProfiler& Get()
+    {
+        static SystemProfiler s_instance; return s_instance;
+    }
+
+    /**
+     * @brief vXbgmۂiOƋ敪Ȃ̃XbgԂj
+     * @return Record() ɓnID
+     * @details System o^ɃCXbhĂԂƁiTick ͌Ă΂ȂjB
+     */
+    std::size_t Register(const std::string& name, Phase phase);
+
+    /**
+     * @brief 1񕪂̏ԂL^
+     * @details ID Ƃɏݐ悪ʂȂ̂ŁA ID łΕXbh瓯ɌĂł悢B
+     */
+    void Record(std::size_t id, double ms);
+
+    /// v̗L/i SystemRegistry vǂ܂Ȃj
+    bool IsEnabled() const { return m_enabled; }
+    void SetEnabled(bool enabled) { m_enabled = enabled; }
+
+    /// Sv 0 ɖ߂iXbg͎cj
+    void Reset();
+
+    /// v̈ꗗ
+    const std::vector<std::unique_ptr<Stats>>& GetAll() const { return m_stats; }
+
+    /** @name _v */
+    ///@{
+    /** @brief CSV ŏoB true */
+    bool DumpCsv(const std::string& path) const;
+    /** @brief JSON ŏoB true */
+    bool DumpJson(const std::string& path) const;
+    ///@}
+
+    /// Clock 2_Ԃ~bŕԂ
+    static double ToMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    /// 敪̕\
+    static const char* PhaseName(Phase phase);
+
+private:
+    SystemProfiler() = default;
+
+    std::vector<std::unique_ptr<Stats>> m_stats;
+    bool m_enabled = true;
+};
@@ -10,21 +10,167 @@
  *********************************************************************/
 #include "SystemRegistry.h"
 #include "../World.h"
+#include "System/JobSystem.h"
+
+#include <algorithm>
+#include <string>
+
+SystemRegistry::SystemRegistry()
+{
+    m_tickProfileId = SystemProfiler::Get().Register("SystemRegistry::Tick", SystemProfiler::Phase::Frame);
+    m_renderTotalProfileId = SystemProfiler::Get().Register("SystemRegistry::Render", SystemProfiler::Phase::Frame);
+}
 
 SystemRegistry::~SystemRegistry() = default;
 
-void SystemRegistry::Tick(World& world, float dt)
+void SystemRegistry::Tick(World& world, float dt, PhaseMask phases)
 {
-    for (auto& s : m_updates)
+    const Waves& waves = GetSchedule(phases);
+
+    SystemProfiler& prof = SystemProfiler::Get();
+    const bool profiling = prof.IsEnabled();
+    const auto tickBegin = profiling ? SystemProfiler::Clock::now() : SystemProfiler::Clock::time_point{};
+
+    // 1sāAvȂ玞ԂL^iEF[uł͕ʃXbhĂ΂j
+    const auto run = [&](std::size_t index)
+        {
+            if (!profiling)
+            {
+                m_updates[index]->Update(world, dt);
+                return;
+            }
+            const auto begin = SystemProfiler::Clock::now();
+            m_updates[index]->Update(world, dt);
+            prof.Record(m_updateProfileIds[index], SystemProfiler::ToMs(begin, SystemProfiler::Clock::now()));
+        };
+
+    for (const auto& wave : waves)
+    {
+        if (wave.size() == 1)
+        {
+            run(wave.front());
+        }
+        else
+        {
+            JobSystem::ParallelFor(wave.size(), 1, [&](std::size_t begin, std::size_t end)
+                {
+                    for (std::size_t i = begin; i < end; ++i)
+                    {
+                        run(wave[i]);
+                    }
+                });
+        }
+
+        // EF[u̍Ԃ𓯊_ƂAς܂ꂽ\ύX𔽉f
+        world.FlushCommands();
+    }
+
+    if (profiling)
     {
-        s->Update(world, dt);
+        prof.Record(m_tickProfileId, SystemProfiler::ToMs(tickBegin, SystemProfiler::Clock::now()));
     }
 }
 
+std::size_t SystemRegistry::RegisterProfile(const char* typeName, SystemProfiler::Phase phase, const std::vector<std::size_t>& used)
+{
+    // MSVC  typeid().name()  "class Foo" `Ȃ̂Őړ𗎂Ƃ
+    std::string name = typeName;
+    for (const char* prefix : { "class ", "struct " })
+    {
+        const std::string p = prefix;
+        if (name.compare(0, p.size(), p) == 0)
+        {
+            name.erase(0, p.size());
+            break;
+        }
+    }
+
+    SystemProfiler& prof = SystemProfiler::Get();
+    std::size_t id = prof.Register(name, phase);
+    for (int n = 2; std::find(used.begin(), used.end(), id) != used.end(); ++n)
+    {
+        id = prof.Register(name + "#" + std::to_string(n), phase);
+    }
+    return id;
+}
+
+const SystemRegistry::Waves& SystemRegistry::GetSchedule(PhaseMask phases)
+{
+    for (const auto& s : m_schedules)
+    {
+        if (s.phases == phases)
+        {
+            return s.waves;
+        }
+    }
+
+    if (m_access.size() != m_updates.size())
+    {
+        m_access.clear();
+        m_access.reserve(m_updates.size());
+        for (const auto& s : m_updates)
+        {
+            m_access.push_back(s->Access());
+        }
+    }
+
+    // ΏۃtF[Y System o^ɏE
+    std::vector<std::size_t> members;
+    for (std::size_t i = 0; i < m_updates.size(); ++i)
+    {
+        if (m_updatePhases[i] & phases)
+        {
+            members.push_back(i);
+        }
+    }
+
+    // level[j] = Փ˂sSystem̍ő僌x + 1
+    std::vector<std::size_t> level(members.size(), 0);
+    std::size_t levelCount = 0;
+    for (std::size_t j = 0; j < members.size(); ++j)
+    {
+        for (std::size_t i = 0; i < j; ++i)
+        {
+            if (level[i] + 1 > level[j] && m_access[members[i]].ConflictsWith(m_access[members[j]]))
+            {
+                level[j] = level[i] + 1;
+            }
+        }
+        levelCount = std::max(levelCount, level[j] + 1);
+    }
+
+    Schedule schedule{ phases, Waves(levelCount) };
+    for (std::size_t j = 0; j < members.size(); ++j)
+    {
+        schedule.waves[level[j]].push_back(members[j]);
+    }
+    m_schedules.push_back(std::move(schedule));
+    return m_schedules.back().waves;
+}
+
 void SystemRegistry::Render(World& world)
 {
-    for (auto& s : m_renders)
+    SystemProfiler& prof = SystemProfiler::Get();
+    const bool profiling = prof.IsEnabled();
+    const auto renderBegin = profiling ? SystemProfiler::Clock::now() : SystemProfiler::Clock::time_point{};
+
+    for (std::size_t i = 0; i < m_renders.size(); ++i)
     {
-        s->Render(world);
+        if (!profiling)
+        {
+            m_renders[i]->Render(world);
+            continue;
+        }
+        const auto begin = SystemProfiler::Clock::now();
+        m_renders[i]->Render(world);
+        prof.Record(m_renderProfileIds[i], SystemProfiler::ToMs(begin, SystemProfiler::Clock::now()));
     }
+
+    if (profiling)
+    {
+        prof.Record(m_renderTotalProfileId, SystemProfiler::ToMs(renderBegin, SystemProfiler::Clock::now()));
+    }
+
+    // 1t[̏ÎŕύXõeBbNi߂
+    world.AdvanceTick();
 }
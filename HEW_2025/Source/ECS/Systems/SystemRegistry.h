@@ -7,18 +7,30 @@
  * Tick()/Render() Ŏs܂B
  *
  * o^̂܂܎sɂȂ܂B
+ *  IUpdateSystem::Access() œǂݏΏۂ錾SystemḿA
+ * Փ˂ȂΓuEF[uvɂ܂Ƃ߂AJobSystem œɎs܂B
+ * Փ˂SystemԂł͓o^ۂ܂B
+ *
+ * e System ̎sԂ SystemProfiler ɋL^܂B
+ *
+ * UpdatenSystemɂ́utF[Yṽrbg}XN܂B
+ * Tick(world, dt, phases)  phases ƏdȂSystemsA
+ * ̎sXg(EF[u)̓}XNƂɈxgݗĂăLbV܂B
  *
  * @author E
  * @date   2025/11/11
  *********************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <type_traits>
+#include <typeinfo>
 
 #include "IUpdateSystem.h"
 #include "IRenderSystem.h"
+#include "SystemProfiler.h"
 
 class World;
 
@@ -29,6 +41,12 @@ class World;
 class SystemRegistry
 {
 public:
+	/// tF[Ỹrbg}XNirbg̈Ӗ͎g߂j
+	using PhaseMask = std::uint32_t;
+	/// StF[Y
+	static constexpr PhaseMask kAllPhases = 0xFFFFFFFFu;
+
+	SystemRegistry();
 	~SystemRegistry();
 
 	//====================================================================
@@ -43,6 +61,9 @@ public:
 		auto ptr = std::make_unique<T>(std::forward<Args>(args)...);
 		T& ref = *ptr;
 		m_updates.emplace_back(std::move(ptr));
+		m_updatePhases.push_back(m_defaultPhases);
+		m_updateProfileIds.push_back(RegisterProfile(typeid(T).name(), SystemProfiler::Phase::Update, m_updateProfileIds));
+		InvalidateSchedules();
 		return ref;
 	}
 
@@ -54,19 +75,49 @@ public:
 		auto ptr = std::make_unique<T>(std::forward<Args>(args)...);
 		T& ref = *ptr;
 		m_renders.emplace_back(std::move(ptr));
+		m_renderProfileIds.push_back(RegisterProfile(typeid(T).name(), SystemProfiler::Phase::Render, m_renderProfileIds));
 		return ref;
 	}
 
+	//====================================================================
+	// tF[Yݒ
+	//====================================================================
+
+	/**
+	 * @brief ȍ~ AddUpdate  System ̃tF[Yi kAllPhasesj
+	 */
+	void SetDefaultUpdatePhases(PhaseMask phases) { m_defaultPhases = phases; }
+
+	/**
+	 * @brief ^T UpdatenSystem ɃtF[Yǉ
+	 * @details o^ɈxĂԑzidynamic_cast ŒT̂Ŗt[͌Ă΂Ȃj
+	 */
+	template <class T>
+	void AddUpdatePhases(PhaseMask phases)
+	{
+		for (std::size_t i = 0; i < m_updates.size(); ++i)
+		{
+			if (dynamic_cast<T*>(m_updates[i].get()))
+			{
+				m_updatePhases[i] |= phases;
+			}
+		}
+		InvalidateSchedules();
+	}
+
 	//====================================================================
 	// s
 	//====================================================================
 
 	/**
-	 * @brief o^ꂽSUpdateVXeɎs
+	 * @brief o^ꂽ UpdateVXêAphases ɑ̂s
 	 * @param world ECSWorld
 	 * @param dt oߎԁibj
+	 * @param phases stF[Yi͑SSystemj
+	 * @details
+	 * EF[uPʂŎsAEF[u̍Ԃ world.FlushCommands() ō\ύX𔽉f܂B
 	 */
-	void Tick(World& world, float dt);
+	void Tick(World& world, float dt, PhaseMask phases = kAllPhases);
 
 	/**
 	 * @brief o^ꂽSRenderVXeɎs
@@ -150,7 +201,56 @@ public:
 		return AddRender<T>(std::forward<Args>(args)...);
 	}
 
+private:
+	/// sEF[uim_updates ̓YBEF[u͓sĂ悢j
+	using Waves = std::vector<std::vector<std::size_t>>;
+
+	/// tF[Y}XNƂ̎sXg
+	struct Schedule
+	{
+		PhaseMask phases;
+		Waves     waves;
+	};
+
+	/**
+	 * @brief phases ɑ System ŎsEF[ugݗĂiLbVς݂Ȃ炻Ԃj
+	 * @details
+	 * eSysteḿuOɓo^AՓ˂SystemvׂĂ̌̃EF[uɓ܂B
+	 */
+	const Waves& GetSchedule(PhaseMask phases);
+
+	/// System \ς̂ŃLbV̂Ă
+	void InvalidateSchedules()
+	{
+		m_schedules.clear();
+		m_access.clear();
+	}
+
+	/**
+	 * @brief SystemProfiler ɓvXbgmۂ
+	 * @param typeName typeid(T).name()i"class " ̐ړ͎菜j
+	 * @param used     ̃WXgŊɊmۂXbgi^2o^ "#2" tj
+	 */
+	static std::size_t RegisterProfile(const char* typeName, SystemProfiler::Phase phase, const std::vector<std::size_t>& used);
+
 private:
 	std::vector<std::unique_ptr<IUpdateSystem>> m_updates;
 	std::vector<std::unique_ptr<IRenderSystem>> m_renders;
+
+	/// e UpdatenSystem ̃tF[Yim_updates Ɠсj
+	std::vector<PhaseMask> m_updatePhases;
+	/// ȍ~ɓo^ System ̃tF[Y
+	PhaseMask m_defaultPhases = kAllPhases;
+
+	/// e UpdatenSystem  Access()iXPW[\zɎ擾j
+	std::vector<SystemAccess> m_access;
+	/// gݗčς݂̎sXgigꂽ}XN̐Bʏ͐j
+	std::vector<Schedule> m_schedules;
+
+	/// SystemProfiler ̃Xbgim_updates / m_renders Ɠсj
+	std::vector<std::size_t> m_updateProfileIds;
+	std::vector<std::size_t> m_renderProfileIds;
+	/// Tick / Render Ŝ̃Xbg
+	std::size_t m_tickProfileId = 0;
+	std::size_t m_renderTotalProfileId = 0;
 };
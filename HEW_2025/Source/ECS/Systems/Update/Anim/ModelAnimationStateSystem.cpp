@@ -43,7 +43,7 @@ void ModelAnimationStateSystem::Update(World& world, float /*dt*/)
                 if (state.current == ModelAnimState::Land && state.requested == ModelAnimState::Idle)
                 {
                     const int landClipNo = table.table[static_cast<size_t>(ModelAnimState::Land)].animeNo;
-                    if (landClipNo >= 0 && mr.model && mr.model->IsPlay(landClipNo))
+                    if (landClipNo >= 0 && anim.instance.IsPlay(landClipNo))
                     {
                         // Idle ւ̐ؑւXLbvĩNGXg͖j
                         return;
@@ -58,7 +58,7 @@ void ModelAnimationStateSystem::Update(World& world, float /*dt*/)
                     // 񃋁[v̏ꍇÃ݂NbvĐĂȂ΍Đv
                     if (!curDesc.loop && curDesc.animeNo >= 0 && mr.model)
                     {
-                        const bool playingSame = mr.model->IsPlay(curDesc.animeNo);
+                        const bool playingSame = anim.instance.IsPlay(curDesc.animeNo);
                         if (!playingSame)
                         {
                             anim.animeNo = curDesc.animeNo;
@@ -31,7 +31,9 @@ void ModelAnimationSystem::Update(World& world, float dt)
                 return;
             }
 
-            Model* model = mr.model.get();
+            // Lfɑ΂ÃGeBeB̍Đ
+            AnimationInstance& instance = anim.instance;
+            instance.Bind(mr.model.get());
 
             // ĐNGXg΁A Play @
             if (anim.playRequested)
@@ -39,12 +41,12 @@ void ModelAnimationSystem::Update(World& world, float dt)
                 if (anim.animeNo >= 0)
                 {
                     // Aj[Vuh͂Ƃ肠񂵁B
-                    model->Play(anim.animeNo, anim.loop, anim.speed);
+                    instance.Play(anim.animeNo, anim.loop, anim.speed);
                 }
                 else
                 {
                     // animeNo < 0 ́uAj~v̈Ӗɂ
-                    model->StopAnimation();
+                    instance.StopAnimation();
                 }
                 // TODO: animeNo < 0 ̏ꍇɁuĐ~vǂ͍㌈߂
 
@@ -52,6 +54,6 @@ void ModelAnimationSystem::Update(World& world, float dt)
             }
 
             // Aj[V̎Ԃi߂
-            model->Step(dt);
+            instance.Step(dt);
         });
 }
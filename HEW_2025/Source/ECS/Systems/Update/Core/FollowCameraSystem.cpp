@@ -28,7 +28,7 @@ void FollowCameraSystem::Update(World& world, float dt)
 {
     // Death][[
     float deathTopY = -FLT_MAX;
-    world.View<TagDeathZone, TransformComponent>([&](EntityId, const TagDeathZone&, const TransformComponent& t) {
+    world.View<const TagDeathZone, const TransformComponent>([&](EntityId, const TagDeathZone&, const TransformComponent& t) {
         const float topY = t.position.y + t.scale.y; if (topY > deathTopY) deathTopY = topY; });
 
     // J
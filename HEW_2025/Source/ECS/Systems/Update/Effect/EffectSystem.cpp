@@ -48,7 +48,7 @@ void EffectSystem::Update(World& world, float dt)
     // ܂^CXV
     EffectRuntime::Update(dt);
 
-    world.View<TransformComponent, EffectComponent>(
+    world.View<const TransformComponent, EffectComponent>(
         [&](EntityId e, const TransformComponent& tr, EffectComponent& efc)
         {
             // EffectRef ΉȂ
@@ -150,7 +150,8 @@ void EffectSystem::Update(World& world, float dt)
 
                     if (efc.autoDestroyEntity)
                     {
-                        world.Destroy(e);
+                        // Ȃ̂Ŕj͓_܂Œx点
+                        world.Commands().Destroy(e);
                     }
                 }
             }
@@ -23,4 +23,13 @@ class EffectSystem final : public IUpdateSystem
 {
 public:
     void Update(World& world, float dt) override;
+
+    /// Effekseer ^CLAGtFNgtGeBeB̈ʒuǂށij Commands oRj
+    SystemAccess Access() const override
+    {
+        return SystemAccess{}
+            .Resource<EffectRuntime::AccessTag>()
+            .ReadIn<EffectComponent, TransformComponent>()
+            .Write<EffectComponent>();
+    }
 };
@@ -14,16 +14,16 @@ void BackGroundScrollSystem::Update(World& world, float dt)
 	// J̈ʒuY
 	float camY = 0.0f;	
 	// J̎擾
-	world.View<TransformComponent, Camera3DComponent>(
-		[&](EntityId e, TransformComponent& tr, Camera3DComponent& cam)
+	world.View<const TransformComponent, const Camera3DComponent>(
+		[&](EntityId e, const TransformComponent& tr, const Camera3DComponent& cam)
 		{
 			camY = tr.position.y;	// J̍
 		}
 	);
 
 	// [v̏
-	world.View<TransformComponent,BackGroundComponent,BackGroundScrollComponent>(
-		[&](EntityId e, TransformComponent& tr,BackGroundComponent& bg,
+	world.View<TransformComponent,const BackGroundComponent,BackGroundScrollComponent>(
+		[&](EntityId e, TransformComponent& tr,const BackGroundComponent& bg,
 			BackGroundScrollComponent& warp)
 		{
 			float h = 0.0f;
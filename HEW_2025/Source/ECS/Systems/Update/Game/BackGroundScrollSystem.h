@@ -30,6 +30,16 @@ public:
 	// [v
 	void Update(class World& world, float dt) override;
 
+	// Jʒuǂ݁AwiGeBeB Transform 
+	SystemAccess Access() const override
+	{
+		return SystemAccess{}
+			.Read<Camera3DComponent>()
+			.ReadIn<Camera3DComponent, TransformComponent>()
+			.Read<BackGroundComponent>()
+			.WriteIn<BackGroundScrollComponent, BackGroundScrollComponent, TransformComponent>();
+	}
+
 private:
 
 };
\ No newline at end of file
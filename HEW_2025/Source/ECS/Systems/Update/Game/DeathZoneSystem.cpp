@@ -43,14 +43,15 @@ void DeathZoneSystem::Update(World& world, float dt)
     const float speedScale = DebugSettings::Get().magmaSpeedScale;
 
     // Death][̏㏸iʏ펞j
-    world.View<TransformComponent, Collider2DComponent>(
-        [&](EntityId e, TransformComponent& tr, Collider2DComponent& col)
+    // SRC_r߂̂ const Ŏ󂯎AfX][ Get Ŏ蒼
+    world.View<const TransformComponent, const Collider2DComponent>(
+        [&](EntityId e, const TransformComponent&, const Collider2DComponent& col)
         {
             if (col.layer == Physics::LAYER_DESU_ZONE)
             {
                 if (magmaOn && !m_triggered)
                 {
-                    tr.position.y += dt * m_riseSpeed * speedScale; // ㏸xi{j
+                    world.Get<TransformComponent>(e).position.y += dt * m_riseSpeed * speedScale; // ㏸xi{j
                 }
             }
         });
@@ -85,10 +86,11 @@ void DeathZoneSystem::Update(World& world, float dt)
             }
 
             // c莞ԂΕԁAΖڕWWɑ
-            world.View<TransformComponent, Collider2DComponent>(
-                [&](EntityId e, TransformComponent& tr, Collider2DComponent& col)
+            world.View<const TransformComponent, const Collider2DComponent>(
+                [&](EntityId e, const TransformComponent&, const Collider2DComponent& col)
                 {
                     if (col.layer != Physics::LAYER_DESU_ZONE) return;
+                    TransformComponent& tr = world.Get<TransformComponent>(e);
 
                     // [ = {Y + i`ʁj
                     float halfY = 0.0f;
@@ -136,119 +138,115 @@ void DeathZoneSystem::Update(World& world, float dt)
             else if (player2 == 0) player2 = e;
         });
 
-    // Փ˃Cxgobt@vC[Death][̐ڐGo
-    for (const auto& ev : eventBuffer->events)
+    // vC[ ~ Death][̐ڐG
+    EntityId hitPlayer = kInvalidEntity;
+    eventBuffer->ForEachContact(Physics::LAYER_PLAYER, Physics::LAYER_DESU_ZONE,
+        [&](const CollisionEvent& ev)
+        {
+            if (!ev.trigger || hitPlayer != kInvalidEntity) return;
+            if (ev.self == player1 || ev.self == player2) hitPlayer = ev.self;
+        });
+    if (hitPlayer == kInvalidEntity || god) return;
+
+    m_triggered = true;
+    m_moveToScreenTop = true; // ʏ[ւ̈ړJn
+    DebugSettings::Get().gameDead = true;
+    DebugSettings::Get().gameTimerRunning = false; // ~
+    TimeAttackManager::Get().NotifyDeath();
+
+    // MessageBoxA(nullptr, "Death][ɐڐG܂!", "Game Over", MB_OK | MB_ICONEXCLAMATION);
+
+    // JGeBeBƈʒu擾iActiveCameraTagj
+    EntityId camEntity2 = kInvalidEntity;
+    TransformComponent* camTr2 = nullptr;
+    world.View<ActiveCameraTag>([&](EntityId e, const ActiveCameraTag&) { camEntity2 = e; });
+    if (camEntity2 != kInvalidEntity && world.Has<TransformComponent>(camEntity2))
+    {
+        camTr2 = &world.Get<TransformComponent>(camEntity2);
+    }
+
+    // fX_̉ʏ[Ym肵A܂莞ԃJEgJn
+    if (camTr2)
     {
-        if ((ev.self == player1 || ev.self == player2) && ev.trigger)
+        m_targetScreenTopY = camTr2->position.y + m_cameraTopOffset;
+    }
+    m_fillRemainSec = m_fillDurationSec;
+
+    // ㏸JnxZbgi̊ԂɐL̉o\j
+    m_inDelay = true;
+    m_delayRemainSec = m_postDeathDelaySec;
+
+    // Q[I[o[UI\AS_̃Jʒuɍ킹
+    world.View<GameOverMenu, Sprite2DComponent, TransformComponent>(
+        [&](EntityId e, const GameOverMenu& gom, Sprite2DComponent& sprite, TransformComponent& tr)
         {
-            auto* colOther = world.TryGet<Collider2DComponent>(ev.other);
-            if (colOther && colOther->layer == Physics::LAYER_DESU_ZONE)
+            sprite.visible = true;
+            if (camTr2)
             {
-                if (god) { continue; }
-                m_triggered = true;
-                m_moveToScreenTop = true; // ʏ[ւ̈ړJn
-                DebugSettings::Get().gameDead = true;
-                DebugSettings::Get().gameTimerRunning = false; // ~
-                TimeAttackManager::Get().NotifyDeath();
-
-                // MessageBoxA(nullptr, "Death][ɐڐG܂!", "Game Over", MB_OK | MB_ICONEXCLAMATION);
-
-                // JGeBeBƈʒu擾iActiveCameraTagj
-                EntityId camEntity2 = kInvalidEntity;
-                TransformComponent* camTr2 = nullptr;
-                world.View<ActiveCameraTag>([&](EntityId e, const ActiveCameraTag&) { camEntity2 = e; });
-                if (camEntity2 != kInvalidEntity && world.Has<TransformComponent>(camEntity2))
+                tr.position.x = camTr2->position.x;
+                tr.position.y = camTr2->position.y;
+                // UI͑Oʂɂ邽ߋ͂ɎOցiKvȂŒZj
+                tr.position.z = camTr2->position.z + 0.0f;
+            }
+        });
+
+    // ȍ~Ǐ]ꍇ̓tH[t^
+    world.View<GameOverMenu>(
+        [&](EntityId e, const GameOverMenu&)
+        {
+            if (camEntity2 != kInvalidEntity)
+            {
+                if (!world.Has<FollowerComponent>(e))
                 {
-                    camTr2 = &world.Get<TransformComponent>(camEntity2);
+                    // View ̒ǉ̓R}hobt@oRōs
+                    world.Commands().Add<FollowerComponent>(e, camEntity2, DirectX::XMFLOAT2{ 0.0f, 0.0f });
                 }
-
-                // fX_̉ʏ[Ym肵A܂莞ԃJEgJn
-                if (camTr2)
+                else
                 {
-                    m_targetScreenTopY = camTr2->position.y + m_cameraTopOffset;
+                    world.Get<FollowerComponent>(e).targetId = camEntity2;
                 }
-                m_fillRemainSec = m_fillDurationSec;
+            }
+        });
 
-                // ㏸JnxZbgi̊ԂɐL̉o\j
-                m_inDelay = true;
-                m_delayRemainSec = m_postDeathDelaySec;
+    // vC[ɉopeNX`ƃAj[Vݒ
+    {
+        EntityId survivor = (hitPlayer == player1) ? player2 : player1;
+        EntityId deadOne = (hitPlayer == player1) ? player1 : player2;
 
-                // Q[I[o[UI\AS_̃Jʒuɍ킹
-                world.View<GameOverMenu, Sprite2DComponent, TransformComponent>(
-                    [&](EntityId e, const GameOverMenu& gom, Sprite2DComponent& sprite, TransformComponent& tr)
-                    {
-                        sprite.visible = true;
-                        if (camTr2)
-                        {
-                            tr.position.x = camTr2->position.x;
-                            tr.position.y = camTr2->position.y;
-                            // UI͑Oʂɂ邽ߋ͂ɎOցiKvȂŒZj
-                            tr.position.z = camTr2->position.z + 0.0f;
-                        }
-                    });
-
-                // ȍ~Ǐ]ꍇ̓tH[t^
-                world.View<GameOverMenu>(
-                    [&](EntityId e, const GameOverMenu&)
-                    {
-                        if (camEntity2 != kInvalidEntity)
-                        {
-                            if (!world.Has<FollowerComponent>(e))
-                            {
-                                auto& fol = world.Add<FollowerComponent>(e);
-                                fol.targetId = camEntity2;
-                                fol.offset = { 0.0f, 0.0f };
-                            }
-                            else
-                            {
-                                world.Get<FollowerComponent>(e).targetId = camEntity2;
-                            }
-                        }
-                    });
-
-                // vC[ɉopeNX`ƃAj[Vݒ
-                {
-                    EntityId survivor = (ev.self == player1) ? player2 : player1;
-                    EntityId deadOne = (ev.self == player1) ? player1 : player2;
+        AssetHandle<Texture> tex = AssetManager::GetTexture("tex_aousagi_gameover");
 
-                    AssetHandle<Texture> tex = AssetManager::GetTexture("tex_aousagi_gameover");
+        if (survivor != 0 && survivor != kInvalidEntity)
+        {
+            // f̋eNX`㏑R|[lgŎw
+            if (!world.Has<DeathTextureOverrideComponent>(survivor))
+            {
+                auto& dto = world.Add<DeathTextureOverrideComponent>(survivor);
+                dto.texture = tex;
+                dto.enabled = true;
+            }
+            else
+            {
+                auto& dto = world.Get<DeathTextureOverrideComponent>(survivor);
+                dto.texture = tex;
+                dto.enabled = true;
+            }
 
-                    if (survivor != 0 && survivor != kInvalidEntity)
-                    {
-                        // f̋eNX`㏑R|[lgŎw
-                        if (!world.Has<DeathTextureOverrideComponent>(survivor))
-                        {
-                            auto& dto = world.Add<DeathTextureOverrideComponent>(survivor);
-                            dto.texture = tex;
-                            dto.enabled = true;
-                        }
-                        else
-                        {
-                            auto& dto = world.Get<DeathTextureOverrideComponent>(survivor);
-                            dto.texture = tex;
-                            dto.enabled = true;
-                        }
-
-                        if (world.Has<ModelAnimationStateComponent>(survivor))
-                        {
-                            world.Get<ModelAnimationStateComponent>(survivor).requested = ModelAnimState::Death;
-                        }
-                    }
+            if (world.Has<ModelAnimationStateComponent>(survivor))
+            {
+                world.Get<ModelAnimationStateComponent>(survivor).requested = ModelAnimState::Death;
+            }
+        }
 
-                    // S͏㏑ĂiKvȂj
-                    if (deadOne != 0 && deadOne != kInvalidEntity)
-                    {
-                        if (world.Has<DeathTextureOverrideComponent>(deadOne))
-                        {
-                            world.Get<DeathTextureOverrideComponent>(deadOne).enabled = false;
-                        }
-                        if (world.Has<ModelAnimationStateComponent>(deadOne))
-                        {
-                            world.Get<ModelAnimationStateComponent>(deadOne).requested = ModelAnimState::Death;
-                        }
-                    }
-                }
-                break;
+        // S͏㏑ĂiKvȂj
+        if (deadOne != 0 && deadOne != kInvalidEntity)
+        {
+            if (world.Has<DeathTextureOverrideComponent>(deadOne))
+            {
+                world.Get<DeathTextureOverrideComponent>(deadOne).enabled = false;
+            }
+            if (world.Has<ModelAnimationStateComponent>(deadOne))
+            {
+                world.Get<ModelAnimationStateComponent>(deadOne).requested = ModelAnimState::Death;
             }
         }
     }
@@ -281,49 +279,52 @@ void DeathZoneSystem::GameOverUpdate(World& world)
         
     }
 
-    //vC[Death][̊Ԃ̋o
-    std::vector<EntityId> players;
-    world.View<PlayerInputComponent>(
-        [&](EntityId e, const PlayerInputComponent& pic)
+    //vC[牺ɃC΂Death][TA][̒SƂ̏c̋𑪂
+    //i][̏ʂ͂SȂ̂ŁASxȂ烌C͕Kj
+    m_playerRays.clear();
+    world.View<const PlayerInputComponent, const TransformComponent>(
+        [&](EntityId e, const PlayerInputComponent&, const TransformComponent& tr)
         {
-            players.push_back(e);
+            RaycastQuery2D ray;
+            ray.originX = tr.position.x;
+            ray.originY = tr.position.y;
+            ray.dirX = 0.0f;
+            ray.dirY = -1.0f;
+            ray.maxDistance = m_warningDistance;
+            ray.mask = Physics::LAYER_DESU_ZONE;
+            ray.ignore = e;
+            m_playerRays.push_back(ray);
         });
 
-    std::vector<EntityId> deathZones;
-    world.View<Collider2DComponent>(
-        [&](EntityId e, const Collider2DComponent& col)
-        {
-            if (col.layer == Physics::LAYER_DESU_ZONE)
-                deathZones.push_back(e);
-        });
-
-    for (EntityId player : players)
+    m_warningActive = false;
+    if (m_query && m_query->IsBound() && !m_playerRays.empty())
     {
-        auto* trPlayer = world.TryGet<TransformComponent>(player);
-        if (!trPlayer) continue;
-
-        for (EntityId deathZone : deathZones)
+        const World& readOnly = world;
+        m_query->RaycastBatch(world, m_playerRays, m_playerHits);
+        for (std::size_t i = 0; i < m_playerHits.size(); ++i)
         {
-            auto* trDeathZone = world.TryGet<TransformComponent>(deathZone);
+            const QueryHit2D& hit = m_playerHits[i];
+            if (!hit.hit) continue;
+
+            const auto* trDeathZone = readOnly.TryGet<TransformComponent>(hit.entity);
             if (!trDeathZone) continue;
 
-            //c̃̕fX][ƃvC[̊Ԃ̋vZ
-            float dy = trPlayer->position.y - trDeathZone->position.y;
-            m_dis = dy * dy;
+            //c̃̕fX][(S)ƃvC[̊Ԃ̋vZ
+            const float dy = m_playerRays[i].originY - trDeathZone->position.y;
+            const float dis = dy * dy;
+            if (dis > m_warningDistance * m_warningDistance) continue;
 
-            if (m_dis <= m_warningDistance * m_warningDistance)
-            {
-                m_warningActive = true;
-                break;
-            }
-            else
+            if (!m_warningActive || dis < m_dis)
             {
-                m_warningActive = false;
-                m_oldDis = m_warningDistance * m_warningDistance;
-                break;
+                m_dis = dis;
             }
+            m_warningActive = true;
         }
     }
+    if (!m_warningActive)
+    {
+        m_oldDis = m_warningDistance * m_warningDistance;
+    }
 
     // xo
     if (m_warningActive)
@@ -8,6 +8,7 @@
 #include "ECS/Systems/IUpdateSystem.h"
 #include "ECS/World.h"
 #include "ECS/Systems/Update/Physics/Collision2DSystem.h"
+#include "ECS/Systems/Update/Physics/PhysicsQuery.h"
 #include "System/GameCommon.h" // Difficulty
 
 class DeathZoneSystem : public IUpdateSystem
@@ -16,6 +17,9 @@ public:
     DeathZoneSystem(Collision2DSystem* colSys) : m_colSys(colSys) {}
     void Update(class World& world, float dt) override;
 	void GameOverUpdate(World& world);
+
+    /// Q[I[o[̌x𒲂ׂ₢킹iV[̂nj
+    void SetPhysicsQuery(PhysicsQuery* query) { m_query = query; }
     // O(`[g/gC)pC^[tFCX
     void ForceDeath() { m_triggered = true; }
     void ResetDeathFlag() { m_triggered = false; }
@@ -36,6 +40,7 @@ public:
     
 private:
     Collision2DSystem* m_colSys = nullptr;  /// S][̓蔻VXe
+    PhysicsQuery* m_query = nullptr;        /// x̃CLXgp
     bool m_triggered = false;               /// S][ɐGꂽǂ
     float m_riseSpeed = 1.0f;               /// ㏸xiftHglj
 
@@ -44,6 +49,8 @@ private:
     bool m_warningActive = false;              ///  xsĂ邩
     float m_dis;                               ///  vZi[p
     float m_oldDis = m_warningDistance * m_warningDistance;                            ///  ÂvZi[p
+    std::vector<RaycastQuery2D> m_playerRays;  ///  vC[Ƃ̉Cig񂷁j
+    std::vector<QueryHit2D> m_playerHits;      ///  ̌
     bool m_sceneSwitch = true;             /// V[؂ւ
 
     // Death̏[Ǐ]ړp
@@ -41,19 +41,14 @@ void GoalSystem::Update(World& world, float dt)
 	// vC[2lȂꍇ͉Ȃ
     bool touched[2] = { false, false };
 
-    // Փ˃Cxgobt@vC[ƃS[̏Փ˂T
-    for (const auto& ev : eventBuffer->events) {
-        // vC[S[
-        if ((ev.self == player1 || ev.self == player2) && ev.trigger) 
+    // vC[ ~ S[̐ڐG
+    eventBuffer->ForEachContact(Physics::LAYER_PLAYER, Physics::LAYER_GOAL,
+        [&](const CollisionEvent& ev)
         {
-            auto* colOther = world.TryGet<Collider2DComponent>(ev.other);
-            if (colOther && colOther->layer == Physics::LAYER_GOAL) 
-            {
-                if (ev.self == player1) touched[0] = true;
-                if (ev.self == player2) touched[1] = true;
-            }
-        }
-    }
+            if (!ev.trigger) return;
+            if (ev.self == player1) touched[0] = true;
+            if (ev.self == player2) touched[1] = true;
+        });
 
 	/// ̃vC[S[ɐGĂNA
     if (touched[0] && touched[1])
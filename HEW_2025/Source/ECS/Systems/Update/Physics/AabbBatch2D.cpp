@@ -0,0 +1,192 @@
+/*****************************************************************//**
+ * @file   AabbBatch2D.cpp
+ * @brief  SoA AABB ꊇdȂ蔻J[l̎
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#include "AabbBatch2D.h"
+
+#include <chrono>
+#include <random>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define AABB_BATCH_AVX 1
+#elif defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define AABB_BATCH_SSE 1
+#endif
+
+namespace AabbBatch2D
+{
+    std::size_t OverlapScalar(const WorldAabb2D& q, const AabbSoA2D& soa,
+        std::size_t begin, std::size_t end, std::uint32_t* out)
+    {
+        const float* minX = soa.minX.data();
+        const float* minY = soa.minY.data();
+        const float* maxX = soa.maxX.data();
+        const float* maxY = soa.maxY.data();
+
+        std::size_t n = 0;
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            if (q.minX < maxX[i] && q.maxX > minX[i] && q.minY < maxY[i] && q.maxY > minY[i])
+            {
+                out[n++] = static_cast<std::uint32_t>(i);
+            }
+        }
+        return n;
+    }
+
+    std::size_t Overlap(const WorldAabb2D& q, const AabbSoA2D& soa,
+        std::size_t begin, std::size_t end, std::uint32_t* out)
+    {
+#if defined(AABB_BATCH_AVX) || defined(AABB_BATCH_SSE)
+        const float* minX = soa.minX.data();
+        const float* minY = soa.minY.data();
+        const float* maxX = soa.maxX.data();
+        const float* maxY = soa.maxY.data();
+
+        std::size_t n = 0;
+        std::size_t i = begin;
+
+#if defined(AABB_BATCH_AVX)
+        const __m256 qMinX = _mm256_set1_ps(q.minX);
+        const __m256 qMinY = _mm256_set1_ps(q.minY);
+        const __m256 qMaxX = _mm256_set1_ps(q.maxX);
+        const __m256 qMaxY = _mm256_set1_ps(q.maxY);
+        for (; i + 8 <= end; i += 8)
+        {
+            __m256 m = _mm256_and_ps(
+                _mm256_cmp_ps(qMinX, _mm256_loadu_ps(maxX + i), _CMP_LT_OQ),
+                _mm256_cmp_ps(qMaxX, _mm256_loadu_ps(minX + i), _CMP_GT_OQ));
+            m = _mm256_and_ps(m, _mm256_cmp_ps(qMinY, _mm256_loadu_ps(maxY + i), _CMP_LT_OQ));
+            m = _mm256_and_ps(m, _mm256_cmp_ps(qMaxY, _mm256_loadu_ps(minY + i), _CMP_GT_OQ));
+
+            const int bits = _mm256_movemask_ps(m);
+            if (bits == 0) continue;
+            for (int k = 0; k < 8; ++k)
+            {
+                if (bits & (1 << k)) out[n++] = static_cast<std::uint32_t>(i + k);
+            }
+        }
+#else
+        const __m128 qMinX = _mm_set1_ps(q.minX);
+        const __m128 qMinY = _mm_set1_ps(q.minY);
+        const __m128 qMaxX = _mm_set1_ps(q.maxX);
+        const __m128 qMaxY = _mm_set1_ps(q.maxY);
+        for (; i + 4 <= end; i += 4)
+        {
+            __m128 m = _mm_and_ps(
+                _mm_cmplt_ps(qMinX, _mm_loadu_ps(maxX + i)),
+                _mm_cmpgt_ps(qMaxX, _mm_loadu_ps(minX + i)));
+            m = _mm_and_ps(m, _mm_cmplt_ps(qMinY, _mm_loadu_ps(maxY + i)));
+            m = _mm_and_ps(m, _mm_cmpgt_ps(qMaxY, _mm_loadu_ps(minY + i)));
+
+            const int bits = _mm_movemask_ps(m);
+            if (bits == 0) continue;
+            for (int k = 0; k < 4; ++k)
+            {
+                if (bits & (1 << k)) out[n++] = static_cast<std::uint32_t>(i + k);
+            }
+        }
+#endif
+        // [̓XJ[
+        return n + OverlapScalar(q, soa, i, end, out + n);
+#else
+        return OverlapScalar(q, soa, begin, end, out);
+#endif
+    }
+
+    const char* SimdName()
+    {
+#if defined(AABB_BATCH_AVX)
+        return "AVX";
+#elif defined(AABB_BATCH_SSE)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+
+    BenchmarkResult RunBenchmark(std::size_t boxCount, std::size_t queryCount)
+    {
+        using Clock = std::chrono::steady_clock;
+        const auto toMs = [](Clock::time_point a, Clock::time_point b)
+            {
+                return std::chrono::duration<double, std::milli>(b - a).count();
+            };
+
+        // Xe[Wx͈̔͂Ƀ^C`vC[x̑傫̔΂܂
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> posX(0.0f, 80.0f);
+        std::uniform_real_distribution<float> posY(0.0f, 600.0f);
+        std::uniform_real_distribution<float> half(0.5f, 2.0f);
+
+        std::vector<TransformComponent> transforms(boxCount);
+        std::vector<Collider2DComponent> colliders(boxCount);
+        AabbSoA2D soa;
+        soa.Reserve(boxCount);
+        for (std::size_t i = 0; i < boxCount; ++i)
+        {
+            transforms[i].position = { posX(rng), posY(rng), 0.0f };
+            colliders[i].aabb.halfX = half(rng);
+            colliders[i].aabb.halfY = half(rng);
+            soa.Push(MakeWorldAabb(transforms[i], colliders[i]));
+        }
+
+        std::vector<TransformComponent> queryT(queryCount);
+        std::vector<Collider2DComponent> queryC(queryCount);
+        std::vector<WorldAabb2D> queries(queryCount);
+        for (std::size_t q = 0; q < queryCount; ++q)
+        {
+            queryT[q].position = { posX(rng), posY(rng), 0.0f };
+            queryC[q].aabb.halfX = half(rng) * 4.0f;
+            queryC[q].aabb.halfY = half(rng) * 4.0f;
+            queries[q] = MakeWorldAabb(queryT[q], queryC[q]);
+        }
+
+        BenchmarkResult result;
+        result.boxCount = boxCount;
+        result.queryCount = queryCount;
+        std::vector<std::uint32_t> out(boxCount);
+
+        // 1) ]: yAƂ Transform + Collider 狫EĔׂ
+        std::size_t pairHits = 0;
+        auto t0 = Clock::now();
+        for (std::size_t q = 0; q < queryCount; ++q)
+        {
+            for (std::size_t i = 0; i < boxCount; ++i)
+            {
+                if (IsAabbOverlap(queryT[q], queryC[q], transforms[i], colliders[i])) ++pairHits;
+            }
+        }
+        auto t1 = Clock::now();
+        result.pairScalarMs = toMs(t0, t1);
+
+        // 2) SoA + XJ[
+        std::size_t scalarHits = 0;
+        t0 = Clock::now();
+        for (std::size_t q = 0; q < queryCount; ++q)
+        {
+            scalarHits += OverlapScalar(queries[q], soa, 0, boxCount, out.data());
+        }
+        t1 = Clock::now();
+        result.batchScalarMs = toMs(t0, t1);
+
+        // 3) SoA + SIMD
+        std::size_t simdHits = 0;
+        t0 = Clock::now();
+        for (std::size_t q = 0; q < queryCount; ++q)
+        {
+            simdHits += Overlap(queries[q], soa, 0, boxCount, out.data());
+        }
+        t1 = Clock::now();
+        result.batchSimdMs = toMs(t0, t1);
+
+        result.hitCount = simdHits;
+        result.hitsMatch = (pairHits == scalarHits) && (scalarHits == simdHits);
+        return result;
+    }
+}
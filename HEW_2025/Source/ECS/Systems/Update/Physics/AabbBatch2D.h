@@ -0,0 +1,95 @@
+/*****************************************************************//**
+ * @file   AabbBatch2D.h
+ * @brief  SoA zɕׂ AABB ܂Ƃ߂ďdȂ蔻肷J[l
+ *
+ *  AABB  minX / minY / maxX / maxY ̕ʁX̔ziSoAjɕׂĂA
+ * 1̃NG AABB  4(SSE) / 8(AVX) r܂B
+ * SIMD gȂł̓XJ[łɃtH[obN܂B
+ *
+ * RunBenchmark() ŁA]́uyAƂ Transform + Collider 狫EvoH
+ * XJ[ / SIMD łׂ܂iImGui  Collision Kernel sjB
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ECS/Components/Physics/CollisionHelpers.h"
+
+/**
+ * @brief AABB  SoA z
+ */
+struct AabbSoA2D
+{
+    std::vector<float> minX;
+    std::vector<float> minY;
+    std::vector<float> maxX;
+    std::vector<float> maxY;
+
+    std::size_t Size() const { return minX.size(); }
+
+    void Clear()
+    {
+        minX.clear();
+        minY.clear();
+        maxX.clear();
+        maxY.clear();
+    }
+
+    void Reserve(std::size_t n)
+    {
+        minX.reserve(n);
+        minY.reserve(n);
+        maxX.reserve(n);
+        maxY.reserve(n);
+    }
+
+    void Push(const WorldAabb2D& b)
+    {
+        minX.push_back(b.minX);
+        minY.push_back(b.minY);
+        maxX.push_back(b.maxX);
+        maxY.push_back(b.maxY);
+    }
+};
+
+namespace AabbBatch2D
+{
+    /**
+     * @brief soa[begin, end) ̂ query ƏdȂ̂̔ԍ out ɏiSIMD Łj
+     * @param out end - begin ȏ㏑̈
+     * @return iԍ͏j
+     * @details ڂĂ邾̂̂͏dȂ舵܂iIsAabbOverlap ƓjB
+     */
+    std::size_t Overlap(const WorldAabb2D& query, const AabbSoA2D& soa,
+        std::size_t begin, std::size_t end, std::uint32_t* out);
+
+    /// Overlap ̃XJ[Łiʂ͓j
+    std::size_t OverlapScalar(const WorldAabb2D& query, const AabbSoA2D& soa,
+        std::size_t begin, std::size_t end, std::uint32_t* out);
+
+    /// Overlap g߃Zbgi"AVX" / "SSE2" / "Scalar"j
+    const char* SimdName();
+
+    /// x`}[N
+    struct BenchmarkResult
+    {
+        std::size_t boxCount = 0;
+        std::size_t queryCount = 0;
+        std::size_t hitCount = 0;     ///< SNG̏dȂ葍
+        bool        hitsMatch = true; ///< 3oȞʂv
+        double      pairScalarMs = 0.0; ///< ]: yAƂ Transform + Collider 画
+        double      batchScalarMs = 0.0;///< SoA + XJ[
+        double      batchSimdMs = 0.0;  ///< SoA + SIMD
+    };
+
+    /**
+     * @brief _ AABB 3oH̑xׂ
+     * @param boxCount ̐
+     * @param queryCount NG̐ieNGSƔׂj
+     */
+    BenchmarkResult RunBenchmark(std::size_t boxCount = 4096, std::size_t queryCount = 256);
+}
@@ -3,103 +3,118 @@
  * @brief  dȂ()ô݂sCxgL^2DRWSystem
  * 
  * ʒu⑬x̉ PhysicsStepSystem ɈϏBł
- * AABB dȂăCxgobt@ɐςނB
+ * AABB dȂăCxgobt@ɐςނiEnter/Stay/Exit ̋ʂ̓obt@jB
+ * yA͐ÓI=StaticGrid2DAI=SweepAndPrune2D ōiB
  * 
  * @author E
  * @date   2025/11/13
  *********************************************************************/
 #include "Collision2DSystem.h"
-#include <algorithm>
-#include <vector>
 #include "ECS/Components/Physics/PhysicsLayers.h"
-#include "ECS/Tag/Tag.h"
+#include "System/Debug.h"
+
+#include <string>
+
+namespace
+{
+    /// iqɌŒœo^Ă悢RC_
+    bool IsFixedCollider(const Collider2DComponent& c)
+    {
+        return c.isStatic && !c.isKinematic;
+    }
+}
 
 void Collision2DSystem::Update(World& world, float /*dt*/)
 {
-    if (m_eventBuffer) m_eventBuffer->Clear();
+    if (m_eventBuffer) m_eventBuffer->BeginFrame();
 
-    // SRC_W
-    struct CollInfo
+    // ÓIRC_//痊܂ꂽƂgݒ
+    if (m_staticDirty)
     {
-        EntityId e;
-        TransformComponent* t;
-        Collider2DComponent* c;
-        float cx; // SX (position + offset)
-        float cy; // SY
-        bool isPlayer;
-    };
-
-    std::vector<CollInfo> colliders;
-    colliders.reserve(128);
-    std::vector<DirectX::XMFLOAT2> playerCenters;
-
-    world.View<TransformComponent, Collider2DComponent>(
-        [&](EntityId e, TransformComponent& t, Collider2DComponent& c)
+        BuildStaticColliders(world);
+    }
+
+    // 1) IRC_̎WiTagDynamicCollider ̕t̂r߂j
+    m_dynamics.clear();
+    m_sap.Begin();
+
+    // ǂނȂ̂ const Ŏ󂯎
+    world.View<const TagDynamicCollider, const TransformComponent, const Collider2DComponent>(
+        [&](EntityId e, const TagDynamicCollider&, const TransformComponent& t, const Collider2DComponent& c)
         {
-            CollInfo info{ e, &t, &c, t.position.x + c.offset.x, t.position.y + c.offset.y, world.Has<TagPlayer>(e) };
-            colliders.emplace_back(info);
-            if (info.isPlayer)
-            {
-                playerCenters.emplace_back(info.cx, info.cy);
-            }
+            // AABB̂ݑΉ
+            if (c.shape != ColliderShapeType::AABB2D) return;
+
+            m_dynamics.push_back(Proxy{ e, MakeWorldAabb(t, c), c.layer, c.hitMask, c.isTrigger });
+            m_sap.Add(e, m_dynamics.back().box);
         }
     );
 
-    if (colliders.empty()) return;
-
-    const bool hasPlayers = !playerCenters.empty();
-    static constexpr float kPlayerCollisionRadius = 500.0f;
-    const float playerRadiusSq = kPlayerCollisionRadius * kPlayerCollisionRadius;
-
-    const size_t n = colliders.size();
-    for (size_t i = 0; i < n; ++i)
+    // 2) I vs ÓIiIRC_ĂZ̐ÓIRC_Ƃׂj
+    for (const Proxy& a : m_dynamics)
     {
-        auto& A = colliders[i];
-        for (size_t j = i + 1; j < n; ++j)
-        {
-            auto& B = colliders[j];
+        // ǂ̐ÓIRC_ƂCȂȂ璲ׂȂiDeath][Ȃǁj
+        if (!CanHitStatic(a.layer, a.hitMask)) continue;
 
-            auto& c1 = *A.c;
-            auto& c2 = *B.c;
+        m_staticGrid.Query(a.box, [&](std::uint32_t s) { Emit(a, m_statics[s]); });
+    }
 
-            // C}XN`FbN
-            const bool hit12 = (c1.hitMask & c2.layer) != 0;
-            const bool hit21 = (c2.hitMask & c1.layer) != 0;
-            if (!hit12 && !hit21) continue;
+    // 3) I vs I
+    m_sap.ForEachPair([&](std::uint32_t i, std::uint32_t j) { Emit(m_dynamics[i], m_dynamics[j]); });
 
-            // AABB̂ݑΉ
-            if (c1.shape != ColliderShapeType::AABB2D || c2.shape != ColliderShapeType::AABB2D)
-                continue;
-
-            // vC[牓vC[m̓XLbv
-            if (hasPlayers && !A.isPlayer && !B.isPlayer)
-            {
-                bool nearPlayer = false;
-                for (auto& pc : playerCenters)
-                {
-                    const float dxA = A.cx - pc.x;
-                    const float dyA = A.cy - pc.y;
-                    const float dxB = B.cx - pc.x;
-                    const float dyB = B.cy - pc.y;
-                    if ((dxA * dxA + dyA * dyA) <= playerRadiusSq || (dxB * dxB + dyB * dyB) <= playerRadiusSq)
-                    {
-                        nearPlayer = true;
-                        break;
-                    }
-                }
-                if (!nearPlayer) continue;
-            }
+    // 4) 񗈂ȂyA Exit ɂ
+    if (m_eventBuffer) m_eventBuffer->EndFrame();
+}
 
-            // dȂeXg
-            if (!IsAabbOverlap(*A.t, c1, *B.t, c2)) continue;
+void Collision2DSystem::BuildStaticColliders(World& world)
+{
+    m_statics.clear();
+    m_staticLayers = 0;
+    m_staticHitMask = 0;
 
-            // Cxgǉ (triggertO͂ǂ炩gK[Ȃtrue)
-            const bool isTrigger = c1.isTrigger || c2.isTrigger;
-            if (m_eventBuffer)
+    std::vector<WorldAabb2D> boxes;
+    std::size_t untagged = 0;
+    world.View<const TransformComponent, const Collider2DComponent>(
+        [&](EntityId e, const TransformComponent& t, const Collider2DComponent& c)
+        {
+            if (c.shape != ColliderShapeType::AABB2D) return;
+            if (world.Has<TagDynamicCollider>(e)) return;
+            if (!IsFixedCollider(c))
             {
-                m_eventBuffer->Add(A.e, B.e, isTrigger);
-                m_eventBuffer->Add(B.e, A.e, isTrigger);
+                // ̂Ƀ^OƁAǂɂ炸ȂȂ
+                ++untagged;
+                return;
             }
+
+            m_statics.push_back(Proxy{ e, MakeWorldAabb(t, c), c.layer, c.hitMask, c.isTrigger });
+            boxes.push_back(m_statics.back().box);
+            m_staticLayers |= c.layer;
+            m_staticHitMask |= c.hitMask;
         }
+    );
+    m_staticGrid.Build(boxes);
+
+    if (untagged > 0)
+    {
+        Debug::Log(LogLevel::Warning, "Collision2DSystem: " + std::to_string(untagged)
+            + " non-static colliders have no TagDynamicCollider and are ignored");
+    }
+
+    m_staticDirty = false;
+    ++m_staticRevision;
+}
+
+void Collision2DSystem::Emit(const Proxy& a, const Proxy& b)
+{
+    // C}XN`FbN
+    const bool hit12 = (a.hitMask & b.layer) != 0;
+    const bool hit21 = (b.hitMask & a.layer) != 0;
+    if (!hit12 && !hit21) return;
+
+    // yA1ǉ (triggertO͂ǂ炩gK[Ȃtrue)
+    const bool isTrigger = a.isTrigger || b.isTrigger;
+    if (m_eventBuffer)
+    {
+        m_eventBuffer->Add(a.e, a.layer, b.e, b.layer, isTrigger);
     }
 }
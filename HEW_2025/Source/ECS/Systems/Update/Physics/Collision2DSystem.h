@@ -9,16 +9,29 @@
  * @date   2025/11/13
  *********************************************************************/
 #pragma once
+#include <cstdint>
+#include <vector>
 #include "../../IUpdateSystem.h"
 #include "ECS/World.h"
 #include "ECS/Components/Physics/TransformComponent.h"
 #include "ECS/Components/Physics/Collider2DComponent.h"
 #include "ECS/Components/Physics/CollisionEvents.h"
 #include "ECS/Components/Physics/CollisionHelpers.h"
+#include "ECS/Tag/Tag.h"
+#include "StaticGrid2D.h"
+#include "SweepAndPrune2D.h"
 
 /**
  * @brief AABB2D ̏dȂ茟ô݂sACxgL^ System
  *        (/߂/x␳͍sȂ)
+ * @details
+ * ÓIRC_iisStatic  !isKinematicj BuildStaticColliders() Ă񂾂Ƃ StaticGrid2D ֓o^A
+ * Xebv TagDynamicCollider ̕tIRC_ SweepAndPrune2D ŕג܂B
+ *  - I vs ÓI: IRC_ĂZ̐ÓIRC_Ƃׂ
+ *  - I vs I: XC[vv[
+ *  - ÓI vs ÓI: ׂȂ
+ * ÓIRC_ォ//ꍇ InvalidateStatics() Ăłi Update őgݒjB
+ * ̂ɂ isKinematic  TagDynamicCollider tĂB
  */
 class Collision2DSystem : public IUpdateSystem
 {
@@ -31,7 +44,65 @@ public:
     void Update(World& world, float dt) override;
     CollisionEventBuffer* GetEventBuffer() const { return m_eventBuffer; }
 
+    /**
+     * @brief ÓIRC_W߂ĊiqgݗĂ
+     * @details Xe[WǂݍݒɌĂԁBĂԂ܂ŐÓIRC_Ƃ͓Ȃ
+     */
+    void BuildStaticColliders(World& world);
+
+    /// ÓIRC_ςƂm点i Update ̓ BuildStaticColliders j
+    void InvalidateStatics() { m_staticDirty = true; }
+
+    /// u[htF[Yɓn1RC_̏
+    struct Proxy
+    {
+        EntityId           e;
+        WorldAabb2D        box;
+        Physics::LayerMask layer;
+        Physics::LayerMask hitMask;
+        bool               isTrigger;
+    };
+
+    /**
+     * @brief box ƏdȂÓIRC_񋓂iǂނBPhysicsStepSystem ̃XC[vpj
+     * @param fn fn(const Proxy&)B1̃RC_ɂ1
+     */
+    template <class Fn>
+    void QueryStatic(const WorldAabb2D& box, Fn&& fn) const
+    {
+        m_staticGrid.Query(box, [&](std::uint32_t s) { fn(m_statics[s]); });
+    }
+
+    /// O Update ŏW߂IRC_ibox ͂̎_̈ʒuj
+    const std::vector<Proxy>& GetDynamicColliders() const { return m_dynamics; }
+
+    /// ÓIRC_gݒтɑiꂪ疰Ă{fBNAȂǂɎgj
+    std::uint32_t GetStaticRevision() const { return m_staticRevision; }
+
+    ///  layer / hitMask ̃RC_蓾ÓIRC_邩
+    bool CanHitStatic(Physics::LayerMask layer, Physics::LayerMask hitMask) const
+    {
+        return (hitMask & m_staticLayers) != 0 || (m_staticHitMask & layer) != 0;
+    }
+
 private:
-    // Փ˃Cxgobt@ (Enter/Stay Ȃǂ̋ʂ͌iōz)
+    /// C΃yAςށidȂ͊mFς݁j
+    void Emit(const Proxy& a, const Proxy& b);
+
+private:
+    // Փ˃Cxgobt@ (Enter/Stay/Exit ̋ʂ̓obt@Ot[Ƃ̍ŕt)
     CollisionEventBuffer* m_eventBuffer = nullptr;
-};
\ No newline at end of file
+
+    StaticGrid2D       m_staticGrid;
+    SweepAndPrune2D    m_sap;
+    std::vector<Proxy> m_statics;
+    std::vector<Proxy> m_dynamics;
+
+    /// ÓIRC_Ŝ layer / hitMask ̘aiI蓾邩̑j
+    Physics::LayerMask m_staticLayers = 0;
+    Physics::LayerMask m_staticHitMask = 0;
+    /// gݒ
+    std::uint32_t m_staticRevision = 0;
+    /// InvalidateStatics() Ă܂gݒĂȂ
+    bool m_staticDirty = false;
+};
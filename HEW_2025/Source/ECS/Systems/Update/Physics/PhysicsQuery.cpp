@@ -0,0 +1,272 @@
+/*****************************************************************//**
+ * @file   PhysicsQuery.cpp
+ * @brief  CLXg / {bNXLXg / dȂ₢킹̎
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#include "PhysicsQuery.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ECS/Components/Physics/TransformComponent.h"
+#include "ECS/Components/Physics/Collider2DComponent.h"
+#include "System/TileCollisionMap.h"
+
+namespace
+{
+    /// CEgK[EwŌ𗎂Ƃ
+    bool Accept(EntityId e, Physics::LayerMask layer, bool isTrigger,
+        Physics::LayerMask mask, bool hitTriggers, EntityId ignore)
+    {
+        return (layer & mask) != 0 && (hitTriggers || !isTrigger) && e != ignore;
+    }
+
+    /// box  (dx, dy) Ƃɒʂ͈
+    WorldAabb2D SweptBounds(const WorldAabb2D& box, float dx, float dy)
+    {
+        return WorldAabb2D{
+            std::min(box.minX, box.minX + dx), std::min(box.minY, box.minY + dy),
+            std::max(box.maxX, box.maxX + dx), std::max(box.maxY, box.maxY + dy) };
+    }
+
+    /// 𐳋Ki 0 Ȃ瓮Ȃj
+    void Normalize(float& x, float& y, float& maxDistance)
+    {
+        const float len = std::sqrt(x * x + y * y);
+        if (len > 0.0f)
+        {
+            x /= len;
+            y /= len;
+        }
+        else
+        {
+            x = y = 0.0f;
+            maxDistance = 0.0f;
+        }
+    }
+}
+
+void PhysicsQuery::Snapshot(const World& world)
+{
+    m_dynamics.clear();
+    m_dynamicBoxes.Clear();
+    if (!m_colSys)
+    {
+        m_candidates.clear();
+        return;
+    }
+
+    // Collision2DSystem ~܂ĂԂ́iDeath][ȂǁĵŁAʒû͍̂ǂݒ
+    const auto& dynamics = m_colSys->GetDynamicColliders();
+    m_dynamicBoxes.Reserve(dynamics.size());
+    for (const Collision2DSystem::Proxy& p : dynamics)
+    {
+        const auto* tr = world.TryGet<TransformComponent>(p.e);
+        const auto* col = world.TryGet<Collider2DComponent>(p.e);
+        if (!tr || !col) continue;
+
+        Collision2DSystem::Proxy q = p;
+        q.box = MakeWorldAabb(*tr, *col);
+        q.layer = col->layer;
+        q.hitMask = col->hitMask;
+        q.isTrigger = col->isTrigger;
+        m_dynamics.push_back(q);
+        m_dynamicBoxes.Push(q.box);
+    }
+    m_candidates.resize(m_dynamics.size());
+}
+
+QueryHit2D PhysicsQuery::Cast(const WorldAabb2D& box, float dirX, float dirY, float maxDistance,
+    Physics::LayerMask mask, bool hitTriggers, EntityId ignore)
+{
+    const float dx = dirX * maxDistance;
+    const float dy = dirY * maxDistance;
+    const WorldAabb2D swept = SweptBounds(box, dx, dy);
+
+    QueryHit2D best;
+    float bestT = 2.0f;
+    auto consider = [&](const WorldAabb2D& target, EntityId e, Physics::LayerMask layer)
+        {
+            float t = 0.0f, nx = 0.0f, ny = 0.0f;
+            if (!IsAabbOverlap(box, target) && !SweepAabb(box, dx, dy, target, t, nx, ny))
+            {
+                return;
+            }
+            if (t >= bestT) return;
+
+            bestT = t;
+            best.hit = true;
+            best.entity = e;
+            best.layer = layer;
+            best.normalX = nx;
+            best.normalY = ny;
+        };
+
+    // ÓIRC_iiq̃ZPʂŌij
+    if (m_colSys)
+    {
+        m_colSys->QueryStatic(swept, [&](const Collision2DSystem::Proxy& p)
+            {
+                if (Accept(p.e, p.layer, p.isTrigger, mask, hitTriggers, ignore))
+                {
+                    consider(p.box, p.e, p.layer);
+                }
+            });
+    }
+
+    // IRC_i|͈͂ƏdȂ̂ SIMD ŏEj
+    const std::size_t n = AabbBatch2D::Overlap(swept, m_dynamicBoxes, 0, m_dynamicBoxes.Size(), m_candidates.data());
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const Collision2DSystem::Proxy& p = m_dynamics[m_candidates[k]];
+        if (Accept(p.e, p.layer, p.isTrigger, mask, hitTriggers, ignore))
+        {
+            consider(p.box, p.e, p.layer);
+        }
+    }
+
+    // ^Ci|͈͂̃ZB^C̓gK[ɂȂȂj
+    if (m_tiles && !m_tiles->Empty() && (m_tiles->GetLayer() & mask) != 0)
+    {
+        const int x0 = std::max(m_tiles->CellX(swept.minX), 0);
+        const int x1 = std::min(m_tiles->CellX(swept.maxX), m_tiles->GetWidth() - 1);
+        const int y0 = std::max(m_tiles->CellY(swept.minY), 0);
+        const int y1 = std::min(m_tiles->CellY(swept.maxY), m_tiles->GetHeight() - 1);
+        for (int y = y0; y <= y1; ++y)
+        {
+            for (int x = x0; x <= x1; ++x)
+            {
+                if (m_tiles->IsSolid(x, y))
+                {
+                    consider(m_tiles->CellBounds(x, y), kInvalidEntity, m_tiles->GetLayer());
+                }
+            }
+        }
+    }
+
+    if (best.hit)
+    {
+        best.distance = bestT * maxDistance;
+        best.pointX = (box.minX + box.maxX) * 0.5f + dirX * best.distance;
+        best.pointY = (box.minY + box.maxY) * 0.5f + dirY * best.distance;
+    }
+    return best;
+}
+
+std::size_t PhysicsQuery::Overlap(const OverlapBoxQuery2D& query, std::uint32_t index, std::vector<OverlapHit2D>& out)
+{
+    const std::size_t before = out.size();
+
+    if (m_colSys)
+    {
+        m_colSys->QueryStatic(query.box, [&](const Collision2DSystem::Proxy& p)
+            {
+                if (Accept(p.e, p.layer, p.isTrigger, query.mask, query.hitTriggers, query.ignore)
+                    && IsAabbOverlap(query.box, p.box))
+                {
+                    out.push_back(OverlapHit2D{ index, p.e, p.layer });
+                }
+            });
+    }
+
+    const std::size_t n = AabbBatch2D::Overlap(query.box, m_dynamicBoxes, 0, m_dynamicBoxes.Size(), m_candidates.data());
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const Collision2DSystem::Proxy& p = m_dynamics[m_candidates[k]];
+        if (Accept(p.e, p.layer, p.isTrigger, query.mask, query.hitTriggers, query.ignore))
+        {
+            out.push_back(OverlapHit2D{ index, p.e, p.layer });
+        }
+    }
+
+    // ^C͂ǂꂩ1łdȂĂ1
+    if (m_tiles && !m_tiles->Empty() && (m_tiles->GetLayer() & query.mask) != 0)
+    {
+        const int x0 = std::max(m_tiles->CellX(query.box.minX), 0);
+        const int x1 = std::min(m_tiles->CellX(query.box.maxX), m_tiles->GetWidth() - 1);
+        const int y0 = std::max(m_tiles->CellY(query.box.minY), 0);
+        const int y1 = std::min(m_tiles->CellY(query.box.maxY), m_tiles->GetHeight() - 1);
+        bool found = false;
+        for (int y = y0; y <= y1 && !found; ++y)
+        {
+            for (int x = x0; x <= x1 && !found; ++x)
+            {
+                found = m_tiles->IsSolid(x, y) && IsAabbOverlap(query.box, m_tiles->CellBounds(x, y));
+            }
+        }
+        if (found)
+        {
+            out.push_back(OverlapHit2D{ index, kInvalidEntity, m_tiles->GetLayer() });
+        }
+    }
+
+    return out.size() - before;
+}
+
+QueryHit2D PhysicsQuery::Raycast(const World& world, const RaycastQuery2D& query)
+{
+    Snapshot(world);
+
+    float dirX = query.dirX, dirY = query.dirY, maxDistance = query.maxDistance;
+    Normalize(dirX, dirY, maxDistance);
+    const WorldAabb2D point{ query.originX, query.originY, query.originX, query.originY };
+    return Cast(point, dirX, dirY, maxDistance, query.mask, query.hitTriggers, query.ignore);
+}
+
+QueryHit2D PhysicsQuery::BoxCast(const World& world, const BoxCastQuery2D& query)
+{
+    Snapshot(world);
+
+    float dirX = query.dirX, dirY = query.dirY, maxDistance = query.maxDistance;
+    Normalize(dirX, dirY, maxDistance);
+    return Cast(query.box, dirX, dirY, maxDistance, query.mask, query.hitTriggers, query.ignore);
+}
+
+std::size_t PhysicsQuery::OverlapBox(const World& world, const OverlapBoxQuery2D& query, std::vector<OverlapHit2D>& out)
+{
+    Snapshot(world);
+    return Overlap(query, 0, out);
+}
+
+void PhysicsQuery::RaycastBatch(const World& world, const std::vector<RaycastQuery2D>& queries, std::vector<QueryHit2D>& outHits)
+{
+    Snapshot(world);
+
+    outHits.resize(queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+        const RaycastQuery2D& q = queries[i];
+        float dirX = q.dirX, dirY = q.dirY, maxDistance = q.maxDistance;
+        Normalize(dirX, dirY, maxDistance);
+        const WorldAabb2D point{ q.originX, q.originY, q.originX, q.originY };
+        outHits[i] = Cast(point, dirX, dirY, maxDistance, q.mask, q.hitTriggers, q.ignore);
+    }
+}
+
+void PhysicsQuery::BoxCastBatch(const World& world, const std::vector<BoxCastQuery2D>& queries, std::vector<QueryHit2D>& outHits)
+{
+    Snapshot(world);
+
+    outHits.resize(queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+        const BoxCastQuery2D& q = queries[i];
+        float dirX = q.dirX, dirY = q.dirY, maxDistance = q.maxDistance;
+        Normalize(dirX, dirY, maxDistance);
+        outHits[i] = Cast(q.box, dirX, dirY, maxDistance, q.mask, q.hitTriggers, q.ignore);
+    }
+}
+
+std::size_t PhysicsQuery::OverlapBoxBatch(const World& world, const std::vector<OverlapBoxQuery2D>& queries, std::vector<OverlapHit2D>& out)
+{
+    Snapshot(world);
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+        total += Overlap(queries[i], static_cast<std::uint32_t>(i), out);
+    }
+    return total;
+}
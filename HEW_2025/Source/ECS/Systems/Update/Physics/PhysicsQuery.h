@@ -0,0 +1,137 @@
+/*****************************************************************//**
+ * @file   PhysicsQuery.h
+ * @brief  u[htF[YgCLXg / {bNXLXg / dȂ₢킹
+ *
+ * Q[ System uɉ邩vu͈̔͂ɒN邩v𒲂ׂƂɁA
+ * World Ŝ View ŉ񂷑ɂg܂B
+ *  - ÓIRC_: Collision2DSystem  StaticGrid2D |͈͂̃Z
+ *  - IRC_: ₢킹1iob`Ȃ1܂Ƃ߁jƂɍ̈ʒu SoA ɕׁA
+ *                  AabbBatch2D ő|͈͂ƏdȂ̂
+ *  - ^C:       TileCollisionMap ̑|͈͂̃Z
+ * ɍiĂ SweepAabb œ鎞߂܂B
+ *
+ * ǂނȂ̂ Transform / Collider ύXɂ܂B
+ * Collision2DSystem ~܂ĂtF[YiQ[I[o[Ȃǁjłg܂A
+ * IRC_̊Ԃ͍Ō Collision2DSystem Ƃ̂̂łB
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ECS/World.h"
+#include "ECS/Components/Physics/CollisionHelpers.h"
+#include "ECS/Components/Physics/PhysicsLayers.h"
+#include "AabbBatch2D.h"
+#include "Collision2DSystem.h"
+
+class TileCollisionMap;
+
+/// ij̖₢킹
+struct RaycastQuery2D
+{
+    float originX = 0.0f;
+    float originY = 0.0f;
+    float dirX = 0.0f;          ///< i͖Ȃj
+    float dirY = -1.0f;
+    float maxDistance = 1.0f;   ///< ׂ钷
+    Physics::LayerMask mask = 0xFFFFFFFF; ///< ẴC
+    bool hitTriggers = true;    ///< gK[ɂĂ邩
+    EntityId ignore = kInvalidEntity;     ///< GeBeBiȂǁj
+};
+
+/// AABB 𓮂₢킹
+struct BoxCastQuery2D
+{
+    WorldAabb2D box{ 0.0f, 0.0f, 0.0f, 0.0f }; ///< Jn AABB
+    float dirX = 0.0f;
+    float dirY = -1.0f;
+    float maxDistance = 1.0f;
+    Physics::LayerMask mask = 0xFFFFFFFF;
+    bool hitTriggers = true;
+    EntityId ignore = kInvalidEntity;
+};
+
+/// AABB ƏdȂ̖̂₢킹
+struct OverlapBoxQuery2D
+{
+    WorldAabb2D box{ 0.0f, 0.0f, 0.0f, 0.0f };
+    Physics::LayerMask mask = 0xFFFFFFFF;
+    bool hitTriggers = true;
+    EntityId ignore = kInvalidEntity;
+};
+
+/// LXǧʁiԋ߂́j
+struct QueryHit2D
+{
+    bool     hit = false;
+    EntityId entity = kInvalidEntity;   ///< RC_i^CȂ kInvalidEntityj
+    Physics::LayerMask layer = 0;       ///< ̃C
+    float    distance = 0.0f;           ///< ܂ł̋iJn_ŏdȂĂ 0j
+    float    pointX = 0.0f;             ///< ̃LXg̒S
+    float    pointY = 0.0f;
+    float    normalX = 0.0f;            ///< ʂ̖@iJn_ŏdȂĂ 0, 0j
+    float    normalY = 0.0f;
+};
+
+/// dȂ̌ʁiob`ł query Ŗ₢킹̔ԍԂj
+struct OverlapHit2D
+{
+    std::uint32_t query = 0;
+    EntityId      entity = kInvalidEntity;
+    Physics::LayerMask layer = 0;
+};
+
+/**
+ * @brief 蔻̖₢킹
+ * @details V[1ACollision2DSystem  Bind Ċe System ɓnB
+ *          ob`ł͓IRC_̕ג1ōς܂̂ŁA
+ *          t[ɉ{Ƃ͂gB
+ */
+class PhysicsQuery
+{
+public:
+    /// ₢킹ݒ肷itiles ̓^Cn` nullptrj
+    void Bind(const Collision2DSystem* colSys, const TileCollisionMap* tiles = nullptr)
+    {
+        m_colSys = colSys;
+        m_tiles = tiles;
+    }
+
+    bool IsBound() const { return m_colSys != nullptr; }
+
+    QueryHit2D Raycast(const World& world, const RaycastQuery2D& query);
+    QueryHit2D BoxCast(const World& world, const BoxCastQuery2D& query);
+
+    /// box ƏdȂRC_ out ɑi^C entity = kInvalidEntity 1j
+    std::size_t OverlapBox(const World& world, const OverlapBoxQuery2D& query, std::vector<OverlapHit2D>& out);
+
+    /// queries[i] ̌ʂ outHits[i] ɏ
+    void RaycastBatch(const World& world, const std::vector<RaycastQuery2D>& queries, std::vector<QueryHit2D>& outHits);
+    void BoxCastBatch(const World& world, const std::vector<BoxCastQuery2D>& queries, std::vector<QueryHit2D>& outHits);
+
+    /// S₢킹̏dȂ out ɑiOverlapHit2D::query ₢킹̔ԍj
+    std::size_t OverlapBoxBatch(const World& world, const std::vector<OverlapBoxQuery2D>& queries, std::vector<OverlapHit2D>& out);
+
+private:
+    /// IRC_̈ʒu m_dynamics / m_dynamicBoxes ɕׂ
+    void Snapshot(const World& world);
+
+    /// box  (dirX, dirY)  maxDistance Ĉԋ߂̂Tidir ͐Kς݁j
+    QueryHit2D Cast(const WorldAabb2D& box, float dirX, float dirY, float maxDistance,
+        Physics::LayerMask mask, bool hitTriggers, EntityId ignore);
+
+    std::size_t Overlap(const OverlapBoxQuery2D& query, std::uint32_t index, std::vector<OverlapHit2D>& out);
+
+private:
+    const Collision2DSystem* m_colSys = nullptr;
+    const TileCollisionMap*  m_tiles = nullptr;
+
+    // ₢킹̍Ɨ̈
+    std::vector<Collision2DSystem::Proxy> m_dynamics;
+    AabbSoA2D                  m_dynamicBoxes;
+    std::vector<std::uint32_t> m_candidates;
+};
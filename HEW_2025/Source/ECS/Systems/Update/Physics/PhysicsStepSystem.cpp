@@ -2,6 +2,10 @@
 /* @file   PhysicsStepSystem.cpp
  * @brief  d́EՓˉȂǂsXebvVXe (o Collision2DSystem ɈϏ)
  * 
+ * IRC_͐ÓIȒn`ɑ΂ăXC[vi鎞߂ĎOŎ~߂jœA
+ * 蔲hBXC[vŏEȂdȂ͏]̉߂ŉB
+ * ~܂Ă{fBi̓j͖点āAϕE߂΂B
+ * 
  * 艻: Nʂ̃Xbv/␳EʑxŃKNጸB
  * ̓Xibv߂Ȃ悤ɘaB
  * 
@@ -12,6 +16,10 @@
 #include <algorithm> // std::min, std::max, std::abs
 #include <cmath>
 #include "ECS/Components/Physics/CollisionEvents.h"
+#include "ECS/Components/Physics/CollisionHelpers.h"
+#include "System/JobSystem.h"
+#include "System/TileCollisionMap.h"
+#include "Collision2DSystem.h"
 
 namespace 
 {
@@ -25,26 +33,131 @@ namespace
     constexpr float kPenetrationSlop = 0.01f;
     // ł߂荞ݒXɂ߂荞ތ̑xW (0`1)
     constexpr float kHorizontalPenetrationDampen = 0.5f;
+
+    // XC[vœɖʂɉĊ点
+    constexpr int kMaxSweepIterations = 3;
+    // XC[vŎ~߂Ƃɖʂ痣Ă (ڂ܂܎̃XebvŏdȂȂ悤)
+    constexpr float kSweepSkin = 0.001f;
+    // ʂƁAȉdȂȂ (pĚp) ̓XC[vł͎~߂Ȃ
+    constexpr float kSweepEdgeTolerance = 0.05f;
+
+    // ̑Ŏ~܂ĂƂ݂Ȃ
+    constexpr float kSleepVelocity = 0.05f;
+    // ~܂܂܂̃t[o疰点
+    constexpr std::uint16_t kSleepFrames = 30;
+    // m_bodyOf ́u{fBł͂Ȃv
+    constexpr std::uint32_t kNoBody = 0xFFFFFFFFu;
+
+    /// XC[vœΏۂ
+    bool IsSweptBody(const Collider2DComponent& col)
+    {
+        return !col.isStatic && !col.isTrigger && col.shape == ColliderShapeType::AABB2D;
+    }
+
+    /// XC[v肵āA~߂ׂȂ true
+    bool SweepAgainst(const WorldAabb2D& box, float dx, float dy, const WorldAabb2D& target,
+        float& t, float& nx, float& ny)
+    {
+        if (!SweepAabb(box, dx, dy, target, t, nx, ny)) return false;
+
+        // _ŁAʂɉɂǂꂾdȂĂ邩
+        const float overlap = (nx != 0.0f)
+            ? std::min(box.maxY + dy * t, target.maxY) - std::max(box.minY + dy * t, target.minY)
+            : std::min(box.maxX + dx * t, target.maxX) - std::max(box.minX + dx * t, target.minX);
+        return overlap > kSweepEdgeTolerance;
+    }
+
+    /// IRC_1n`^C牟߂
+    void ResolveBodyAgainstTiles(const TileCollisionMap& map,
+        TransformComponent& tr, Rigidbody2DComponent& rb, const Collider2DComponent& col)
+    {
+        if (col.isStatic || col.isTrigger || col.shape != ColliderShapeType::AABB2D) return;
+        if (!map.CanCollide(col.layer, col.hitMask)) return;
+
+        const WorldAabb2D start = MakeWorldAabb(tr, col);
+        const int x0 = map.CellX(start.minX), x1 = map.CellX(start.maxX);
+        const int y0 = map.CellY(start.minY), y1 = map.CellY(start.maxY);
+
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            for (int cx = x0; cx <= x1; ++cx)
+            {
+                if (!map.IsSolid(cx, cy)) continue;
+
+                // ÕZŉ߂Ă邩Ȃ̂Ŗ蒼
+                const WorldAabb2D box = MakeWorldAabb(tr, col);
+                const WorldAabb2D cell = map.CellBounds(cx, cy);
+                if (!IsAabbOverlap(box, cell)) continue;
+
+                // XbvKp
+                const float overlapX = std::max(0.0f, std::min(box.maxX, cell.maxX) - std::max(box.minX, cell.minX) - kPenetrationSlop);
+                const float overlapY = std::max(0.0f, std::min(box.maxY, cell.maxY) - std::max(box.minY, cell.minY) - kPenetrationSlop);
+                if (overlapX <= 0.0f && overlapY <= 0.0f) continue;
+
+                const float dirX = ((box.minX + box.maxX) >= (cell.minX + cell.maxX)) ? 1.0f : -1.0f; // +1 Z̉E
+                const float dirY = ((box.minY + box.maxY) >= (cell.minY + cell.maxY)) ? 1.0f : -1.0f; // +1 Z̏
+
+                // õZ܂ĂȂA̖ʂ͒n`̓Ȃ̂ŎgȂ
+                // iĂƂɃ^ČpڂŉɈ̂hj
+                const bool openX = !map.IsSolid(cx + static_cast<int>(dirX), cy);
+                const bool openY = !map.IsSolid(cx, cy + static_cast<int>(dirY));
+
+                // D掲: ȂN (iȂǂŉ߂)
+                if (openY && overlapY > 0.0f && (!openX || overlapY <= overlapX))
+                {
+                    tr.position.y += dirY * overlapY * kVerticalCorrectionPercent;
+                    if (rb.velocity.y * dirY < 0.0f) rb.velocity.y = 0.0f;
+                    if (dirY > 0.0f) rb.onGround = true;
+                }
+                else if (openX && overlapX > 0.0f)
+                {
+                    // ̓Xibv߂
+                    tr.position.x += dirX * overlapX * kHorizontalCorrectionPercent;
+                    if (rb.velocity.x * dirX < 0.0f)
+                    {
+                        rb.velocity.x *= kHorizontalPenetrationDampen; // [ɂ͂Ȃ
+                    }
+                }
+            }
+        }
+    }
 }
 
 void PhysicsStepSystem::Update(World& world, float dt)
 {
-
+    // 0) Ă{fBāA񓮂̂߂
+    UpdateSleep(world);
 
     // 1) d͂𑬓x֓Kp@x -> ʒu f
-    world.View<TransformComponent, Rigidbody2DComponent>(
-        [&](EntityId /*e*/, TransformComponent& tr, Rigidbody2DComponent& rb)
+    // IRC_͐ÓIȒn`ɑ΂ăXC[vē
+    // eGeBeB͎ Transform/Rigidbody G炸ARC_ƒn`͓ǂނȂ̂ŕɉ
+    // iĂ̂ Transform ͐GȂ̂ŕύXɂȂȂj
+    const World& readOnly = world;
+    JobSystem::ParallelFor(m_awake.size(), 0, [&](std::size_t begin, std::size_t end)
         {
-            if (rb.useGravity)
+            for (std::size_t i = begin; i < end; ++i)
             {
-                rb.velocity.y += kGravity * dt;
-            }
+                const EntityId e = m_awake[i];
+                TransformComponent& tr = world.Get<TransformComponent>(e);
+                Rigidbody2DComponent& rb = world.Get<Rigidbody2DComponent>(e);
 
-            tr.position.x += rb.velocity.x * dt;
-            tr.position.y += rb.velocity.y * dt;
-            rb.onGround = false; // ڒn͌ōĔ
-        }
-    );
+                if (rb.useGravity)
+                {
+                    rb.velocity.y += kGravity * dt;
+                }
+                rb.onGround = false; // ڒn͌ōĔ (XC[vŒnꍇ͂ŗĂ)
+
+                const Collider2DComponent* col = readOnly.TryGet<Collider2DComponent>(e);
+                if (col && IsSweptBody(*col))
+                {
+                    MoveSwept(tr, rb, *col, dt);
+                    continue;
+                }
+
+                tr.position.x += rb.velocity.x * dt;
+                tr.position.y += rb.velocity.y * dt;
+            }
+        });
 
     // 2) Փˉ (CxgoR)
     if (m_eventBuffer)
@@ -52,37 +165,33 @@ void PhysicsStepSystem::Update(World& world, float dt)
         for (const auto& ev : m_eventBuffer->events)
         {
             if (ev.trigger) continue;
-            if (ev.self >= ev.other) continue; // yAɓ
+            if (ev.phase == CONTACT_EXIT) continue; // ꂽyA͉Ȃi1yA1œ͂j
+            // ǂȂiÓIEĂjȂȂ
+            if (!IsMovingBody(readOnly, ev.self) && !IsMovingBody(readOnly, ev.other)) continue;
 
-            auto* tA = world.TryGet<TransformComponent>(ev.self);
-            auto* tB = world.TryGet<TransformComponent>(ev.other);
-            auto* cA = world.TryGet<Collider2DComponent>(ev.self);
-            auto* cB = world.TryGet<Collider2DComponent>(ev.other);
-            if (!tA || !tB || !cA || !cB) continue;
+            const auto* cA = readOnly.TryGet<Collider2DComponent>(ev.self);
+            const auto* cB = readOnly.TryGet<Collider2DComponent>(ev.other);
+            const auto* rA = readOnly.TryGet<TransformComponent>(ev.self);
+            const auto* rB = readOnly.TryGet<TransformComponent>(ev.other);
+            if (!rA || !rB || !cA || !cB) continue;
             if (cA->shape != ColliderShapeType::AABB2D || cB->shape != ColliderShapeType::AABB2D) continue;
 
-            auto* rbA = world.TryGet<Rigidbody2DComponent>(ev.self);
-            auto* rbB = world.TryGet<Rigidbody2DComponent>(ev.other);
+            const bool aStatic = cA->isStatic || cA->isTrigger;
+            const bool bStatic = cB->isStatic || cB->isTrigger;
+
+            // ݂Ŏ͓̂iÓIύXɂ Collision2DSystem iqgݒĂ܂j
+            auto* tA = aStatic ? nullptr : world.TryGet<TransformComponent>(ev.self);
+            auto* tB = bStatic ? nullptr : world.TryGet<TransformComponent>(ev.other);
+            auto* rbA = aStatic ? nullptr : world.TryGet<Rigidbody2DComponent>(ev.self);
+            auto* rbB = bStatic ? nullptr : world.TryGet<Rigidbody2DComponent>(ev.other);
 
             // AABB
-            const float axMin = tA->position.x + cA->offset.x - cA->aabb.halfX;
-            const float axMax = tA->position.x + cA->offset.x + cA->aabb.halfX;
-            const float ayMin = tA->position.y + cA->offset.y - cA->aabb.halfY;
-            const float ayMax = tA->position.y + cA->offset.y + cA->aabb.halfY;
-            const float bxMin = tB->position.x + cB->offset.x - cB->aabb.halfX;
-            const float bxMax = tB->position.x + cB->offset.x + cB->aabb.halfX;
-            const float byMin = tB->position.y + cB->offset.y - cB->aabb.halfY;
-            const float byMax = tB->position.y + cB->offset.y + cB->aabb.halfY;
-
-            const bool overlapX = (axMin < bxMax) && (axMax > bxMin);
-            const bool overlapY = (ayMin < byMax) && (ayMax > byMin);
-            if (!overlapX || !overlapY) continue;
-
-            float overlapYAmount = std::min(ayMax, byMax) - std::max(ayMin, byMin);
-            float overlapXAmount = std::min(axMax, bxMax) - std::max(axMin, bxMin);
+            const WorldAabb2D a = MakeWorldAabb(*rA, *cA);
+            const WorldAabb2D b = MakeWorldAabb(*rB, *cB);
+            if (!IsAabbOverlap(a, b)) continue;
 
-            const bool aStatic = cA->isStatic || cA->isTrigger;
-            const bool bStatic = cB->isStatic || cB->isTrigger;
+            float overlapYAmount = std::min(a.maxY, b.maxY) - std::max(a.minY, b.minY);
+            float overlapXAmount = std::min(a.maxX, b.maxX) - std::max(a.minX, b.minX);
 
             // XbvKp
             overlapXAmount = std::max(0.0f, overlapXAmount - kPenetrationSlop);
@@ -94,8 +203,8 @@ void PhysicsStepSystem::Update(World& world, float dt)
 
             if (resolveYFirst && overlapYAmount > 0.0f)
             {
-                const float aCenterY = tA->position.y + cA->offset.y;
-                const float bCenterY = tB->position.y + cB->offset.y;
+                const float aCenterY = rA->position.y + cA->offset.y;
+                const float bCenterY = rB->position.y + cB->offset.y;
                 const float dir = (aCenterY >= bCenterY) ? 1.0f : -1.0f; // +1 A above B
                 float correction = overlapYAmount * kVerticalCorrectionPercent;
 
@@ -124,8 +233,8 @@ void PhysicsStepSystem::Update(World& world, float dt)
             else if (overlapXAmount > 0.0f)
             {
                 // ̓Xibv߂: Ⴂ + Nx̂݌/ێ
-                const float aCenterX = tA->position.x + cA->offset.x;
-                const float bCenterX = tB->position.x + cB->offset.x;
+                const float aCenterX = rA->position.x + cA->offset.x;
+                const float bCenterX = rB->position.x + cB->offset.x;
                 const float dir = (aCenterX >= bCenterX) ? 1.0f : -1.0f; // +1 A right of B
                 float correction = overlapXAmount * kHorizontalCorrectionPercent;
 
@@ -157,16 +266,267 @@ void PhysicsStepSystem::Update(World& world, float dt)
         }
     }
 
+    // 2b) n`^CƂ̏Փˉ
+    if (m_tileMap && !m_tileMap->Empty())
+    {
+        ResolveTiles(world);
+    }
+
     // 3) nʈ艻: x[ (/kh~)
-    world.View<Rigidbody2DComponent>(
-        [&](EntityId /*e*/, Rigidbody2DComponent& rb)
+    //    킹Ď~܂Ăt[𐔂i󒆂őx̒_͐Ȃj
+    for (const EntityId e : m_awake)
+    {
+        Rigidbody2DComponent& rb = world.Get<Rigidbody2DComponent>(e);
+        if (rb.onGround && rb.velocity.y < 0.0f && rb.velocity.y > -2.0f)
         {
-            if (rb.onGround && rb.velocity.y < 0.0f && rb.velocity.y > -2.0f)
+            rb.velocity.y = 0.0f;
+        }
+
+        const float speedSq = rb.velocity.x * rb.velocity.x + rb.velocity.y * rb.velocity.y;
+        const bool resting = (rb.onGround || !rb.useGravity) && speedSq < kSleepVelocity * kSleepVelocity;
+        if (!resting)
+        {
+            rb.restFrames = 0;
+        }
+        else if (rb.restFrames < kSleepFrames)
+        {
+            ++rb.restFrames;
+        }
+    }
+
+    // eBbN̂Ɍi System Ă{fB𓮂ĂE悤A1Oo
+    m_lastStepTick = world.CurrentTick() - 1;
+}
+
+void PhysicsStepSystem::UpdateSleep(World& world)
+{
+    const World& readOnly = world;
+
+    // {fBW߂
+    m_bodies.clear();
+    readOnly.View<const TransformComponent, const Rigidbody2DComponent>(
+        [&](EntityId e, const TransformComponent&, const Rigidbody2DComponent&) { m_bodies.push_back(e); });
+
+    // ÓIRC_gݒꂽAꂪȂ̂őSN
+    bool wakeAll = false;
+    if (m_staticColliders && m_staticColliders->GetStaticRevision() != m_staticRevision)
+    {
+        m_staticRevision = m_staticColliders->GetStaticRevision();
+        wakeAll = true;
+    }
+
+    const std::size_t count = m_bodies.size();
+    m_bodyOf.assign(world.EntityCapacity(), kNoBody);
+    m_islandOf.resize(count);
+    m_bodyWake.assign(count, 0);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const EntityId e = m_bodies[i];
+        m_bodyOf[EntityIndex(e)] = i;
+        m_islandOf[i] = i;
+
+        // NĂ闝R: ꂪς / 点Ȃݒ / ܂~܂肫ĂȂ / x͂ꂽ / O瓮ꂽ
+        const Rigidbody2DComponent& rb = readOnly.Get<Rigidbody2DComponent>(e);
+        const float speedSq = rb.velocity.x * rb.velocity.x + rb.velocity.y * rb.velocity.y;
+        m_bodyWake[i] = wakeAll
+            || !rb.allowSleep
+            || rb.restFrames < kSleepFrames
+            || speedSq >= kSleepVelocity * kSleepVelocity
+            || rb.accumulatedForce.x != 0.0f || rb.accumulatedForce.y != 0.0f
+            || (rb.isSleeping && readOnly.IsChangedSince<TransformComponent>(e, m_lastStepTick));
+    }
+
+    // O̐ڐGœɂ܂Ƃ߂
+    if (m_eventBuffer)
+    {
+        for (const auto& ev : m_eventBuffer->events)
+        {
+            if (ev.trigger) continue;
+
+            const std::uint32_t a = (EntityIndex(ev.self) < m_bodyOf.size()) ? m_bodyOf[EntityIndex(ev.self)] : kNoBody;
+            const std::uint32_t b = (EntityIndex(ev.other) < m_bodyOf.size()) ? m_bodyOf[EntityIndex(ev.other)] : kNoBody;
+            const bool aBody = (a != kNoBody) && m_bodies[a] == ev.self;
+            const bool bBody = (b != kNoBody) && m_bodies[b] == ev.other;
+
+            // Gn߂ / ꂽiꂪꍇ܂ށjȂN
+            if (ev.phase != CONTACT_STAY)
+            {
+                if (aBody) m_bodyWake[a] = 1;
+                if (bBody) m_bodyWake[b] = 1;
+            }
+            if (ev.phase == CONTACT_EXIT) continue;
+
+            if (aBody && bBody)
             {
-                rb.velocity.y = 0.0f;
+                const std::uint32_t ra = FindIsland(a);
+                const std::uint32_t rb = FindIsland(b);
+                if (ra != rb) m_islandOf[ra] = rb;
+                continue;
+            }
+
+            // ɏĂԂ͖点Ȃ
+            const EntityId other = aBody ? ev.other : ev.self;
+            const Collider2DComponent* otherCol = readOnly.TryGet<Collider2DComponent>(other);
+            if (otherCol && otherCol->isKinematic)
+            {
+                if (aBody) m_bodyWake[a] = 1;
+                if (bBody) m_bodyWake[b] = 1;
             }
         }
-    );
+    }
+
+    // ̒1łN闝RΓƋN
+    m_islandAwake.assign(count, 0);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        if (m_bodyWake[i]) m_islandAwake[FindIsland(i)] = 1;
+    }
+
+    m_awake.clear();
+    m_bodyAwake.assign(count, 0);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const EntityId e = m_bodies[i];
+        const Rigidbody2DComponent& rb = readOnly.Get<Rigidbody2DComponent>(e);
+        if (m_islandAwake[FindIsland(i)])
+        {
+            if (rb.isSleeping) world.Get<Rigidbody2DComponent>(e).WakeUp();
+            m_bodyAwake[i] = 1;
+            m_awake.push_back(e);
+        }
+        else if (!rb.isSleeping)
+        {
+            Rigidbody2DComponent& sleeper = world.Get<Rigidbody2DComponent>(e);
+            sleeper.isSleeping = true;
+            sleeper.velocity = { 0.0f, 0.0f };
+        }
+    }
+}
+
+std::uint32_t PhysicsStepSystem::FindIsland(std::uint32_t i)
+{
+    while (m_islandOf[i] != i)
+    {
+        m_islandOf[i] = m_islandOf[m_islandOf[i]]; // oHk߂
+        i = m_islandOf[i];
+    }
+    return i;
+}
+
+bool PhysicsStepSystem::IsMovingBody(const World& world, EntityId e) const
+{
+    const Collider2DComponent* col = world.TryGet<Collider2DComponent>(e);
+    if (!col || col->isStatic || col->isTrigger) return false;
+
+    const std::uint32_t i = (EntityIndex(e) < m_bodyOf.size()) ? m_bodyOf[EntityIndex(e)] : kNoBody;
+    if (i == kNoBody || m_bodies[i] != e) return true; // Rigidbody ͏]ǂ艟߂
+    return m_bodyAwake[i] != 0;
+}
+
+void PhysicsStepSystem::MoveSwept(TransformComponent& tr, Rigidbody2DComponent& rb, const Collider2DComponent& col, float dt) const
+{
+    const TileCollisionMap* map = (m_tileMap && !m_tileMap->Empty() && m_tileMap->CanCollide(col.layer, col.hitMask))
+        ? m_tileMap : nullptr;
+    const Collision2DSystem* statics = (m_staticColliders && m_staticColliders->CanHitStatic(col.layer, col.hitMask))
+        ? m_staticColliders : nullptr;
+
+    float dx = rb.velocity.x * dt;
+    float dy = rb.velocity.y * dt;
+
+    for (int iter = 0; iter < kMaxSweepIterations && (dx != 0.0f || dy != 0.0f); ++iter)
+    {
+        const WorldAabb2D box = MakeWorldAabb(tr, col);
+        // ̈ړŒʂ͈
+        const WorldAabb2D swept{
+            box.minX + std::min(dx, 0.0f), box.minY + std::min(dy, 0.0f),
+            box.maxX + std::max(dx, 0.0f), box.maxY + std::max(dy, 0.0f) };
+
+        bool  hit = false;
+        float hitT = 1.0f, hitNx = 0.0f, hitNy = 0.0f;
+        const auto keepEarliest = [&](float t, float nx, float ny)
+            {
+                if (!hit || t < hitT)
+                {
+                    hit = true;
+                    hitT = t;
+                    hitNx = nx;
+                    hitNy = ny;
+                }
+            };
+
+        // n`^Ciʂ͈͂̃Zj
+        if (map)
+        {
+            const int x0 = std::max(map->CellX(swept.minX), 0);
+            const int x1 = std::min(map->CellX(swept.maxX), map->GetWidth() - 1);
+            const int y0 = std::max(map->CellY(swept.minY), 0);
+            const int y1 = std::min(map->CellY(swept.maxY), map->GetHeight() - 1);
+            for (int cy = y0; cy <= y1; ++cy)
+            {
+                for (int cx = x0; cx <= x1; ++cx)
+                {
+                    if (!map->IsSolid(cx, cy)) continue;
+
+                    float t, nx, ny;
+                    if (!SweepAgainst(box, dx, dy, map->CellBounds(cx, cy), t, nx, ny)) continue;
+                    // ʂ̊O܂ĂȂn`̖̓ʂȂ̂ŎgȂ
+                    if (map->IsSolid(cx + static_cast<int>(nx), cy + static_cast<int>(ny))) continue;
+                    keepEarliest(t, nx, ny);
+                }
+            }
+        }
+
+        // ÓIRC_
+        if (statics)
+        {
+            statics->QueryStatic(swept, [&](const Collision2DSystem::Proxy& s)
+                {
+                    if (s.isTrigger) return;
+                    if ((col.hitMask & s.layer) == 0 && (s.hitMask & col.layer) == 0) return;
+
+                    float t, nx, ny;
+                    if (SweepAgainst(box, dx, dy, s.box, t, nx, ny)) keepEarliest(t, nx, ny);
+                });
+        }
+
+        if (!hit)
+        {
+            tr.position.x += dx;
+            tr.position.y += dy;
+            break;
+        }
+
+        // ܂Ői߂āAʂ班
+        tr.position.x += dx * hitT + hitNx * kSweepSkin;
+        tr.position.y += dy * hitT + hitNy * kSweepSkin;
+
+        // ʂɌx
+        if (hitNx != 0.0f && rb.velocity.x * hitNx < 0.0f) rb.velocity.x = 0.0f;
+        if (hitNy != 0.0f && rb.velocity.y * hitNy < 0.0f) rb.velocity.y = 0.0f;
+        if (hitNy > 0.0f) rb.onGround = true;
+
+        // c̈ړ͖ʂɉ
+        dx = (hitNx != 0.0f) ? 0.0f : dx * (1.0f - hitT);
+        dy = (hitNy != 0.0f) ? 0.0f : dy * (1.0f - hitT);
+    }
+}
+
+void PhysicsStepSystem::ResolveTiles(World& world)
+{
+    const TileCollisionMap& map = *m_tileMap;
+    const World& readOnly = world;
+
+    // NĂ{fBBeGeBeB͎ Transform/Rigidbody G炸A}bv͓ǂނȂ̂ŕɉ
+    JobSystem::ParallelFor(m_awake.size(), 0, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const EntityId e = m_awake[i];
+                const Collider2DComponent* col = readOnly.TryGet<Collider2DComponent>(e);
+                if (!col) continue;
+                ResolveBodyAgainstTiles(map, world.Get<TransformComponent>(e), world.Get<Rigidbody2DComponent>(e), *col);
+            }
+        });
 }
 
 void PhysicsStepSystem::ResolveAabbVsAabb(EntityId, TransformComponent&, Collider2DComponent&, Rigidbody2DComponent*,
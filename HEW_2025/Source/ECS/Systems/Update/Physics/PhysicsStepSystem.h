@@ -6,6 +6,8 @@
  * @date   2025/11/13
  *********************************************************************/
 #pragma once
+#include <cstdint>
+#include <vector>
 #include "../../IUpdateSystem.h"
 #include "ECS/World.h"
 
@@ -17,6 +19,9 @@
 
 #include "../../../Components/Physics/CollisionEvents.h"
 
+class TileCollisionMap;
+class Collision2DSystem;
+
 /**
  * @brief xʒuɔfARC_[m̂߂荞݂镨Xebv
  *
@@ -29,20 +34,65 @@
  *  - ÓIIuWFNg()ɂ߂荞񂾂瓮IIuWFNg߂
  *  - gK[Ȃ牟߂ɃCxgobt@ɋl߂
  *  - MovingPlatform Ă鍡t[̈ړʂAĂ鑤ɓKpł悤ɂ
+ *  - TileCollisionMap nꍇ́An`^Cɑ΂Ă߂
+ *    iIRC_dȂĂZj
+ *  - IRC_͐ÓIȒn`i^C / Collision2DSystem ̐ÓIRC_jɑ΂
+ *    ړʂԂXC[vAŎ~߂ĖʂɉĊ点B
+ *    1Xebv̈ړʂ^C傫ȂĂ蔲ȂB
+ *    Jn_ŏdȂĂ̂p̂̂͏]̉߂ɔC
+ *  - ~܂܂ kSleepFrames o{fB͖点Aϕ߂ȂB
+ *    ڐGĂ{fBm͓iAChjɂ܂Ƃ߁AŜ~܂Ƃ点A
+ *    1łN闝RΓƋN
  */
 class PhysicsStepSystem : public IUpdateSystem
 {
 public:
-    PhysicsStepSystem(CollisionEventBuffer* eventBuffer)
+    PhysicsStepSystem(CollisionEventBuffer* eventBuffer, const TileCollisionMap* tileMap = nullptr)
         : m_eventBuffer(eventBuffer)
+        , m_tileMap(tileMap)
     {
     }
 
     void Update(World& world, float dt) override;
 
+    /**
+     * @brief XC[vɎgÓIRC_iCollision2DSystem ̊iqjn
+     * @details nȂꍇAXC[v̓^Cɑ΂Ăs
+     */
+    void SetStaticColliders(const Collision2DSystem* colSys) { m_staticColliders = colSys; }
+
 private:
 	// Փ˃Cxgobt@
     CollisionEventBuffer* m_eventBuffer = nullptr;
+    // n`^C̓i΃^CƂ̉߂͂Ȃj
+    const TileCollisionMap* m_tileMap = nullptr;
+    // XC[vɎgÓIRC_i΃^Cj
+    const Collision2DSystem* m_staticColliders = nullptr;
+
+    // 蔻piXebv蒼j
+    std::vector<EntityId>      m_bodies;      // Transform + Rigidbody 
+    std::vector<std::uint32_t> m_bodyOf;      // EntityIndex  m_bodies ̔ԍ
+    std::vector<std::uint32_t> m_islandOf;    // iunion-find ̐ej
+    std::vector<std::uint8_t>  m_bodyWake;    // NĂ闝R
+    std::vector<std::uint8_t>  m_islandAwake; // ̑\  ƋN
+    std::vector<std::uint8_t>  m_bodyAwake;   // 񓮂
+    std::vector<EntityId>      m_awake;       // 񓮂
+    // OXebveBbN1Oi Transform ĂNj
+    std::uint32_t              m_lastStepTick = 0;
+    // O񌩂ÓIRC_̔Łiς瑫ꂪςȂ̂őSNj
+    std::uint32_t              m_staticRevision = 0;
+
+    // Ă{fB m_awake iƂɖ点/Nj
+    void UpdateSleep(World& world);
+    // e 񓮂{fBiÓIEgK[EĂ̂ falsej
+    bool IsMovingBody(const World& world, EntityId e) const;
+    std::uint32_t FindIsland(std::uint32_t i);
+
+    // IRC_ÓIȒn`ɓƂ܂œiʂɉĊ点j
+    void MoveSwept(TransformComponent& tr, Rigidbody2DComponent& rb, const Collider2DComponent& col, float dt) const;
+
+    // IRC_n`^C牟߂
+    void ResolveTiles(World& world);
 
     // AABBm̓⏕
     void ResolveAabbVsAabb(EntityId a, TransformComponent& ta, Collider2DComponent& ca, Rigidbody2DComponent* ra,
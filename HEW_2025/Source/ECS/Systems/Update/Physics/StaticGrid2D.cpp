@@ -0,0 +1,103 @@
+/*****************************************************************//**
+ * @file   StaticGrid2D.cpp
+ * @brief  ÓIRC_p̕sςȈliqiCSR`j̎
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#include "StaticGrid2D.h"
+
+StaticGrid2D::StaticGrid2D(float cellSize)
+    : m_baseCellSize(cellSize)
+    , m_invCellSize(1.0f / cellSize)
+{
+}
+
+void StaticGrid2D::Clear()
+{
+    m_cols = m_rows = 0;
+    m_cellStart.clear();
+    m_items.clear();
+    m_cellBoxes.Clear();
+    m_boxes.clear();
+}
+
+void StaticGrid2D::Build(const std::vector<WorldAabb2D>& boxes)
+{
+    Clear();
+    if (boxes.empty())
+    {
+        return;
+    }
+    m_boxes = boxes;
+
+    // Ŝ͂ޔ͈
+    m_bounds = boxes.front();
+    for (const WorldAabb2D& b : boxes)
+    {
+        m_bounds.minX = std::min(m_bounds.minX, b.minX);
+        m_bounds.minY = std::min(m_bounds.minY, b.minY);
+        m_bounds.maxX = std::max(m_bounds.maxX, b.maxX);
+        m_bounds.maxY = std::max(m_bounds.maxY, b.maxY);
+    }
+
+    // Zꍇ̓Z{XɍL
+    float cellSize = m_baseCellSize;
+    for (;;)
+    {
+        m_cols = static_cast<int>(std::floor((m_bounds.maxX - m_bounds.minX) / cellSize)) + 1;
+        m_rows = static_cast<int>(std::floor((m_bounds.maxY - m_bounds.minY) / cellSize)) + 1;
+        if (static_cast<std::size_t>(m_cols) * m_rows <= kMaxCells)
+        {
+            break;
+        }
+        cellSize *= 2.0f;
+    }
+    m_invCellSize = 1.0f / cellSize;
+
+    // 1) ZƂ̌𐔂
+    const std::size_t cellCount = static_cast<std::size_t>(m_cols) * m_rows;
+    m_cellStart.assign(cellCount + 1, 0);
+    for (const WorldAabb2D& b : boxes)
+    {
+        const int x0 = CellX(b.minX), x1 = CellX(b.maxX);
+        const int y0 = CellY(b.minY), y1 = CellY(b.maxY);
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            for (int cx = x0; cx <= x1; ++cx)
+            {
+                ++m_cellStart[static_cast<std::size_t>(cy) * m_cols + cx + 1];
+            }
+        }
+    }
+
+    // 2) ݐςĊJnʒuɂ
+    for (std::size_t c = 0; c < cellCount; ++c)
+    {
+        m_cellStart[c + 1] += m_cellStart[c];
+    }
+
+    // 3) ԍɋl߂iZ͔ԍ̏ɂȂj
+    m_items.resize(m_cellStart[cellCount]);
+    std::vector<std::uint32_t> cursor(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (std::uint32_t p = 0; p < boxes.size(); ++p)
+    {
+        const WorldAabb2D& b = boxes[p];
+        const int x0 = CellX(b.minX), x1 = CellX(b.maxX);
+        const int y0 = CellY(b.minY), y1 = CellY(b.maxY);
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            for (int cx = x0; cx <= x1; ++cx)
+            {
+                m_items[cursor[static_cast<std::size_t>(cy) * m_cols + cx]++] = p;
+            }
+        }
+    }
+
+    // 4) ꊇpɃZ SoA 
+    m_cellBoxes.Reserve(m_items.size());
+    for (const std::uint32_t p : m_items)
+    {
+        m_cellBoxes.Push(m_boxes[p]);
+    }
+}
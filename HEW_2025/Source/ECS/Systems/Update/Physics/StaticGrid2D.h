@@ -0,0 +1,126 @@
+/*****************************************************************//**
+ * @file   StaticGrid2D.h
+ * @brief  ÓIRC_p̕sςȈliqiCSR`j
+ *
+ * Xe[Wǂݍ݌Ɉx Build() Aȍ~͓ǂނłB
+ * Z͐ÓIRC_Ŝ͂ޔ͈͂𖧂ɎA
+ *   m_cellStart[cell] ` m_cellStart[cell + 1] ͈̔͂ m_items ̃Z̒g
+ * ƂсiCSRjɂĂ̂ŁAZQƂ̓nbV̓YvZōς݂܂B
+ *
+ * Z̑傫̓Xe[W̃^C(2.0)ɍ킹Ă܂B
+ * Z AABB  m_items Ɠт SoA ɂĂA
+ * AabbBatch2D  SIMD ꊇ肵܂B
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "ECS/Components/Physics/CollisionHelpers.h"
+#include "AabbBatch2D.h"
+
+class StaticGrid2D
+{
+public:
+    /// Xe[W̃^C1iStageLoader  worldTileW/H Ɠj
+    static constexpr float kDefaultCellSize = 2.0f;
+
+    explicit StaticGrid2D(float cellSize = kDefaultCellSize);
+
+    /**
+     * @brief iqgݗĒ
+     * @param boxes ÓIRC_ AABBiŶ܂ܔԍɂȂj
+     */
+    void Build(const std::vector<WorldAabb2D>& boxes);
+
+    /// ɂ
+    void Clear();
+
+    bool Empty() const { return m_boxes.empty(); }
+
+    /**
+     * @brief box ƏdȂÓIRC_񋓂
+     * @param fn fn(proxy)B1̃RC_ɂ1񂾂Aԍ̏ZɌĂ΂
+     */
+    template <class Fn>
+    void Query(const WorldAabb2D& box, Fn&& fn) const
+    {
+        if (m_boxes.empty()
+            || box.maxX < m_bounds.minX || box.minX > m_bounds.maxX
+            || box.maxY < m_bounds.minY || box.minY > m_bounds.maxY)
+        {
+            return;
+        }
+
+        const int x0 = CellX(box.minX), x1 = CellX(box.maxX);
+        const int y0 = CellY(box.minY), y1 = CellY(box.maxY);
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            for (int cx = x0; cx <= x1; ++cx)
+            {
+                const std::size_t cell = static_cast<std::size_t>(cy) * m_cols + cx;
+                const std::size_t end = m_cellStart[cell + 1];
+                for (std::size_t begin = m_cellStart[cell]; begin < end; begin += kQueryChunk)
+                {
+                    // Z̒g܂Ƃ߂ĔidȂ̂ m_items ̈ʒuԂj
+                    std::uint32_t hits[kQueryChunk];
+                    const std::size_t chunkEnd = (end - begin > kQueryChunk) ? begin + kQueryChunk : end;
+                    const std::size_t hitCount = AabbBatch2D::Overlap(box, m_cellBoxes, begin, chunkEnd, hits);
+
+                    for (std::size_t h = 0; h < hitCount; ++h)
+                    {
+                        const std::uint32_t p = m_items[hits[h]];
+                        const WorldAabb2D& other = m_boxes[p];
+                        // ZŏdȂꍇ́AdȂ̈̍ĂZło
+                        const float ox = (box.minX > other.minX) ? box.minX : other.minX;
+                        const float oy = (box.minY > other.minY) ? box.minY : other.minY;
+                        if (CellX(ox) == cx && CellY(oy) == cy)
+                        {
+                            fn(p);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    /// Z𒴂ȂZ傫iɒ[ɍLzuւ̕یj
+    static constexpr std::size_t kMaxCells = std::size_t{ 1 } << 22;
+    /// 1̈ꊇňiʂX^bNɒu߁j
+    static constexpr std::size_t kQueryChunk = 64;
+
+    int CellX(float x) const
+    {
+        // ͈͊O̍Wł int Ɏ܂悤 float ̂Ɋۂ߂
+        const float c = std::floor((x - m_bounds.minX) * m_invCellSize);
+        return static_cast<int>(std::clamp(c, 0.0f, static_cast<float>(m_cols - 1)));
+    }
+
+    int CellY(float y) const
+    {
+        const float c = std::floor((y - m_bounds.minY) * m_invCellSize);
+        return static_cast<int>(std::clamp(c, 0.0f, static_cast<float>(m_rows - 1)));
+    }
+
+private:
+    float m_baseCellSize;
+    float m_invCellSize;
+
+    /// SÓIRC_͂ޔ͈
+    WorldAabb2D m_bounds{ 0.0f, 0.0f, 0.0f, 0.0f };
+    int m_cols = 0;
+    int m_rows = 0;
+
+    /// Z c ̒g m_items[m_cellStart[c] .. m_cellStart[c + 1])
+    std::vector<std::uint32_t> m_cellStart;
+    std::vector<std::uint32_t> m_items;
+    /// m_items Ɠт AABBiSoAj
+    AabbSoA2D                  m_cellBoxes;
+    /// ÓIRC_ AABBiԍňj
+    std::vector<WorldAabb2D>   m_boxes;
+};
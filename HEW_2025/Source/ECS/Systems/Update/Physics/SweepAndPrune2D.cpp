@@ -0,0 +1,70 @@
+/*****************************************************************//**
+ * @file   SweepAndPrune2D.cpp
+ * @brief  IRC_p̎IȃXC[vv[̎
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#include "SweepAndPrune2D.h"
+
+void SweepAndPrune2D::Begin()
+{
+    m_bodies.clear();
+    ++m_frame;
+}
+
+void SweepAndPrune2D::Add(EntityId e, const WorldAabb2D& box)
+{
+    const std::uint32_t idx = EntityIndex(e);
+    if (m_slots.size() <= idx)
+    {
+        m_slots.resize(idx + 1);
+    }
+
+    Slot& slot = m_slots[idx];
+    slot.e = e;
+    slot.proxy = static_cast<std::uint32_t>(m_bodies.size());
+    slot.addedFrame = m_frame;
+    m_bodies.push_back(Body{ e, box });
+}
+
+void SweepAndPrune2D::Sync()
+{
+    // 1) Ot[̕т̂At[o^Ă̂c
+    std::size_t kept = 0;
+    for (const Entry& entry : m_order)
+    {
+        Slot& slot = m_slots[EntityIndex(entry.e)];
+        if (slot.e != entry.e || slot.addedFrame != m_frame || slot.placedFrame == m_frame)
+        {
+            continue;
+        }
+        slot.placedFrame = m_frame;
+        m_order[kept++] = Entry{ entry.e, slot.proxy, m_bodies[slot.proxy].box.minX };
+    }
+    m_order.resize(kept);
+
+    // 2) Vo^ꂽ̂𖖔ɑ
+    for (std::uint32_t p = 0; p < m_bodies.size(); ++p)
+    {
+        Slot& slot = m_slots[EntityIndex(m_bodies[p].e)];
+        if (slot.placedFrame != m_frame)
+        {
+            slot.placedFrame = m_frame;
+            m_order.push_back(Entry{ m_bodies[p].e, p, m_bodies[p].box.minX });
+        }
+    }
+
+    // 3) }\[giOt[قƂǓĂȂ̂łقڐ`j
+    for (std::size_t i = 1; i < m_order.size(); ++i)
+    {
+        const Entry key = m_order[i];
+        std::size_t j = i;
+        while (j > 0 && m_order[j - 1].minX > key.minX)
+        {
+            m_order[j] = m_order[j - 1];
+            --j;
+        }
+        m_order[j] = key;
+    }
+}
@@ -0,0 +1,100 @@
+/*****************************************************************//**
+ * @file   SweepAndPrune2D.h
+ * @brief  IRC_p̎IȃXC[vv[iXj
+ *
+ * IRC_ivC[AADeath][Ȃǁj͐ȂA
+ * t[ԂłقƂǕтςȂ̂ŁAminX ̕тz
+ * }\[gŒɂĂ܂iقڐς݂Ȃق O(n)jB
+ *
+ * g:
+ * @code
+ * sap.Begin();
+ * for (...) sap.Add(entity, box);     // ǉ̂܂ܔԍ(proxy)ɂȂ
+ * sap.ForEachPair([&](std::uint32_t a, std::uint32_t b) { ... });
+ * @endcode
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "ECS/ECS.h"
+#include "ECS/Components/Physics/CollisionHelpers.h"
+
+class SweepAndPrune2D
+{
+public:
+    /// t[̓o^n߂
+    void Begin();
+
+    /**
+     * @brief t[̓IRC_o^
+     * @details Ot[ɂo^ĂGeBeB́Aт̈ʒup܂B
+     */
+    void Add(EntityId e, const WorldAabb2D& box);
+
+    /// o^
+    std::size_t Size() const { return m_bodies.size(); }
+
+    /**
+     * @brief dȂĂyA񋓂
+     * @param fn fn(a, b)Ba, b  Add ̔ԍia < bjB1yAɂ1񂾂Ă΂
+     */
+    template <class Fn>
+    void ForEachPair(Fn&& fn)
+    {
+        Sync();
+
+        const std::size_t n = m_order.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::uint32_t a = m_order[i].proxy;
+            const WorldAabb2D& boxA = m_bodies[a].box;
+            for (std::size_t j = i + 1; j < n && m_order[j].minX < boxA.maxX; ++j)
+            {
+                const std::uint32_t b = m_order[j].proxy;
+                const WorldAabb2D& boxB = m_bodies[b].box;
+                if (boxA.minY < boxB.maxY && boxA.maxY > boxB.minY && boxB.maxX > boxA.minX)
+                {
+                    fn(a < b ? a : b, a < b ? b : a);
+                }
+            }
+        }
+    }
+
+private:
+    /// t[̓o^e
+    struct Body
+    {
+        EntityId    e;
+        WorldAabb2D box;
+    };
+
+    /// minX ̕сit[܂Ŏzj
+    struct Entry
+    {
+        EntityId      e;
+        std::uint32_t proxy;
+        float         minX;
+    };
+
+    /// GeBeB̃XbgԍƂ́At[̓o^
+    struct Slot
+    {
+        EntityId      e = kInvalidEntity;
+        std::uint32_t proxy = 0;
+        std::uint32_t addedFrame = 0;  ///< ̒l m_frame Ȃ獡t[o^ς
+        std::uint32_t placedFrame = 0; ///< ̒l m_frame Ȃтɓꂽ
+    };
+
+    /// Ot[̕т̂OAV̂𑫂 minX ɒ
+    void Sync();
+
+private:
+    std::vector<Body>  m_bodies;
+    std::vector<Entry> m_order;
+    std::vector<Slot>  m_slots;
+    std::uint32_t      m_frame = 0;
+};
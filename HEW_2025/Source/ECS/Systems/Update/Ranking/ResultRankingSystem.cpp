@@ -36,7 +36,7 @@ void ResultRankingSystem::Update(World& world, float /*dt*/)
 	// Jʒu
 	DirectX::XMFLOAT3 camPos = { 0.0f,0.0f,0.0f };
 	bool foundCam = false;
-	world.View<ActiveCameraTag, TransformComponent>(
+	world.View<const ActiveCameraTag, const TransformComponent>(
 		[&](EntityId /*e*/,const ActiveCameraTag& /*tag*/, const TransformComponent& tr)
 		{
 			camPos = tr.position;
@@ -19,11 +19,11 @@ namespace {
     /**
      * @brief ANeBuJ̒SYƐˉe擾
      */
-    bool GetActiveCamera(World& world, TransformComponent*& camTr, Camera3DComponent*& cam)
+    bool GetActiveCamera(const World& world, const TransformComponent*& camTr, const Camera3DComponent*& cam)
     {
         camTr = nullptr; cam = nullptr;
         world.View<ActiveCameraTag, TransformComponent, Camera3DComponent>(
-            [&](EntityId, ActiveCameraTag&, TransformComponent& tr, Camera3DComponent& c)
+            [&](EntityId, const ActiveCameraTag&, const TransformComponent& tr, const Camera3DComponent& c)
             {
                 camTr = &tr;
                 cam   = &c;
@@ -34,9 +34,12 @@ namespace {
 
 void PlayerOffscreenIndicatorSystem::Update(World& world, float /*dt*/)
 {
-    TransformComponent* camTr = nullptr;
-    Camera3DComponent* cam = nullptr;
-    if (!GetActiveCamera(world, camTr, cam)) return;
+    //  System Ɠɑ邽߁ÃCWP[^ȊO const œǂ
+    const World& readOnly = world;
+
+    const TransformComponent* camTr = nullptr;
+    const Camera3DComponent* cam = nullptr;
+    if (!GetActiveCamera(readOnly, camTr, cam)) return;
 
     const float camCenterY = camTr->position.y;
     const float halfOrthoH = cam->orthoHeight * 0.5f;
@@ -52,7 +55,7 @@ void PlayerOffscreenIndicatorSystem::Update(World& world, float /*dt*/)
                 return;
             }
 
-            const auto& targetTr = world.Get<TransformComponent>(ind.targetId);
+            const auto& targetTr = readOnly.Get<TransformComponent>(ind.targetId);
             const bool isBelow = (targetTr.position.y < bottomY);
             ind.visible = isBelow;
             sprite.visible = ind.visible;
@@ -11,6 +11,12 @@
 #pragma once
 #include "ECS/Systems/IUpdateSystem.h"
 #include "ECS/World.h"
+#include "ECS/Components/UI/OffscreenIndicatorComponent.h"
+#include "ECS/Components/Physics/TransformComponent.h"
+#include "ECS/Components/Core/Camera3DComponent.h"
+#include "ECS/Components/Core/ActiveCameraTag.h"
+#include "ECS/Components/Render/Sprite2DComponent.h"
+#include "ECS/Tag/Tag.h"
 
 class PlayerOffscreenIndicatorSystem : public IUpdateSystem
 {
@@ -21,4 +27,14 @@ public:
      * @param dt oߎԁibj
      */
     void Update(World& world, float dt) override;
+
+    /// JƃvC[ʒuǂ݁ACWP[^g Transform/Sprite 
+    SystemAccess Access() const override
+    {
+        return SystemAccess{}
+            .Read<ActiveCameraTag, Camera3DComponent>()
+            .ReadIn<ActiveCameraTag, TransformComponent>()
+            .ReadIn<TagPlayer, TransformComponent>()
+            .WriteIn<OffscreenIndicatorComponent, OffscreenIndicatorComponent, TransformComponent, Sprite2DComponent>();
+    }
 };
@@ -11,4 +11,5 @@ struct TagPlayer {};		///< 
 struct TagDeathZone {};	    ///< SGA^O
 struct TagGoalArea {};	    ///< S[GA^O
 struct GameOverMenu {};	  ///< Q[I[o[j[^O
+struct TagDynamicCollider {};	///< XebviÓIiqɍڂȂjRC_̃^O
 
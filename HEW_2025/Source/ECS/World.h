@@ -11,34 +11,288 @@
 #pragma once
 
 #include "ECS.h"
-#include <unordered_map>
-#include <typeindex>
+#include "CommandBuffer.h"
+#include "System/JobSystem.h"
 #include <type_traits>
 #include <memory>
+#include <new>
+#include <vector>
+#include <algorithm>
 #include <utility>
+#include <tuple>
 #include <cassert>
 
- /**
-  * @brief e^Tp̃R|[lgXg[W
-  * @tparam T ǗR|[lǧ^
-  *
-  * GeBeBIDL[ɂāÃGeBeBT1ێ܂B
-  */
+/**
+ * @brief GeBeBID̏W\Xp[XZbgi^ɈˑȂj
+ *
+ * @details
+ * - dense  : ̃GeBeBIDl߂ĕׂz
+ * - sparse : GeBeB̃Xbgԍ  dense ̓Y y[W̍
+ *
+ * dense ɐ㍞݂IDĂ̂ŁAÂIDňꍇ́uĂȂvɂȂ܂B
+ * View ͂̌^̂܂܊eXg[W̗vfׁAŏ̂̂𑖍̋N_ɂ܂B
+ */
+class SparseSet : public IComponentStorage
+{
+public:
+	/// sparse 1y[W̃GeBeB
+	static constexpr std::size_t kSparsePageSize = 4096;
+	/// ũGeBeB͎ĂȂv\Y
+	static constexpr std::uint32_t kNpos = 0xFFFFFFFFu;
+
+	bool Has(EntityId e) const override
+	{
+		return IndexOf(e) != kNpos;
+	}
+
+	/// ێĂGeBeB
+	std::size_t Size() const { return m_entities.size(); }
+
+	/// dense  i Ԗڂ̎
+	EntityId EntityAt(std::size_t i) const { return m_entities[i]; }
+
+	/// dense ̓YiĂȂEႢȂ kNposj
+	std::uint32_t IndexOf(EntityId e) const
+	{
+		const std::size_t slot = EntityIndex(e);
+		const std::size_t page = slot / kSparsePageSize;
+		if (page >= m_sparse.size() || !m_sparse[page])
+		{
+			return kNpos;
+		}
+		const std::uint32_t idx = m_sparse[page][slot % kSparsePageSize];
+		return (idx != kNpos && m_entities[idx] == e) ? idx : kNpos;
+	}
+
+	/**
+	 * @brief dense 2vfւ
+	 * @details World ̃O[vALXg[W̐擪Ƀo[l߂邽߂Ɏg܂B
+	 */
+	virtual void SwapAt(std::uint32_t a, std::uint32_t b)
+	{
+		if (a == b)
+		{
+			return;
+		}
+		const EntityId ea = m_entities[a];
+		const EntityId eb = m_entities[b];
+		m_entities[a] = eb;
+		m_entities[b] = ea;
+		SparseSlot(ea) = b;
+		SparseSlot(eb) = a;
+	}
+
+protected:
+	/// ɃGeBeBǉA̓YԂ
+	std::uint32_t PushEntity(EntityId e)
+	{
+		const std::uint32_t pos = static_cast<std::uint32_t>(m_entities.size());
+		m_entities.push_back(e);
+		SparseSlot(e) = pos;
+		return pos;
+	}
+
+	/// idx ̗vf𖖔vfŖ߂1k߂i{̑̈ړ͔hNXɍς܂j
+	void EraseEntityAt(std::uint32_t idx)
+	{
+		const EntityId removed = m_entities[idx];
+		const std::size_t last = m_entities.size() - 1;
+		if (idx != last)
+		{
+			const EntityId moved = m_entities[last];
+			m_entities[idx] = moved;
+			SparseSlot(moved) = idx;
+		}
+		m_entities.pop_back();
+		SparseSlot(removed) = kNpos;
+	}
+
+private:
+	/// sparse ̃XbgiKvȂy[WmۂājԂ
+	std::uint32_t& SparseSlot(EntityId e)
+	{
+		const std::size_t slot = EntityIndex(e);
+		const std::size_t page = slot / kSparsePageSize;
+		if (page >= m_sparse.size())
+		{
+			m_sparse.resize(page + 1);
+		}
+		if (!m_sparse[page])
+		{
+			m_sparse[page].reset(new std::uint32_t[kSparsePageSize]);
+			std::fill_n(m_sparse[page].get(), kSparsePageSize, kNpos);
+		}
+		return m_sparse[page][slot % kSparsePageSize];
+	}
+
+private:
+	/// Xbgԍ  dense Yiy[Wj
+	std::vector<std::unique_ptr<std::uint32_t[]>> m_sparse;
+	/// dense ̊evf̎
+	std::vector<EntityId> m_entities;
+};
+
+/**
+ * @brief e^Tp̃R|[lgXg[W
+ * @tparam T ǗR|[lǧ^
+ *
+ * @details
+ * SparseSet  dense YƓтŃR|[lg{̂܂B
+ * Has/Get ͔zQƂ݂̂ O(1)AView  dense r߂邾ɂȂ܂B
+ * R|[lg{̂̓y[WPʂŊmۂ邽߁AǉĂ܂łɕԂQƂ͓܂B
+ * 폜͖vfŌ𖄂߂(swap & pop)߁A폜ꂽvfƖvf̎QƂ̂ݖɂȂ܂B
+ * LO[v(World::DeclareGroup)ɓĂ^́Ǎ^ Add/Remove 
+ * O[v֏o肷邽тɗvfւ̂ŁǍ Get ňĂB
+ * vfƂɁuŌɏ\Ȍ`ŐGꂽeBbNvAύXo(Changed<T>)Ɏg܂B
+ */
 template <class T>
-struct ComponentStorage final : public IComponentStorage
+class ComponentStorage final : public SparseSet
 {
-	/// GeBeBIDL[ƂR|[lg̃}bv
-	std::unordered_map<EntityId, T> data;
+public:
+	/// i[ĂR|[lg^
+	using ValueType = T;
+
+	/// dense 1y[W̃R|[lg
+	static constexpr std::size_t kDensePageSize = 1024;
+
+	ComponentStorage() = default;
+	ComponentStorage(const ComponentStorage&) = delete;
+	ComponentStorage& operator=(const ComponentStorage&) = delete;
+
+	~ComponentStorage() override
+	{
+		for (std::size_t i = 0; i < Size(); ++i)
+		{
+			At(i).~T();
+		}
+	}
+
+	/**
+	 * @brief R|[lg𐶐iɂΏ㏑j
+	 * @return /㏑R|[lgւ̎Q
+	 */
+	template <class... Args>
+	T& Emplace(EntityId e, Args&&... args)
+	{
+		const std::uint32_t idx = IndexOf(e);
+		if (idx != kNpos)
+		{
+			T& ref = At(idx);
+			ref = T{ std::forward<Args>(args)... };
+			return ref;
+		}
+
+		const std::size_t pos = Size();
+		if (pos / kDensePageSize >= m_pages.size())
+		{
+			m_pages.emplace_back(static_cast<Slot*>(::operator new(sizeof(Slot) * kDensePageSize)));
+		}
+		T* ptr = new (&m_pages[pos / kDensePageSize][pos % kDensePageSize]) T{ std::forward<Args>(args)... };
+
+		PushEntity(e);
+		m_ticks.push_back(0);
+		return *ptr;
+	}
 
 	void Remove(EntityId e) override
 	{
-		data.erase(e);
+		const std::uint32_t idx = IndexOf(e);
+		if (idx == kNpos)
+		{
+			return;
+		}
+
+		// vf폜ʒuֈڂČ𖄂߂
+		const std::size_t last = Size() - 1;
+		if (idx != last)
+		{
+			At(idx) = std::move(At(last));
+			m_ticks[idx] = m_ticks[last];
+		}
+		At(last).~T();
+		m_ticks.pop_back();
+		EraseEntityAt(idx);
+
+		// y[WۂƋ󂢂
+		if (!m_pages.empty() && Size() <= (m_pages.size() - 1) * kDensePageSize)
+		{
+			m_pages.pop_back();
+		}
 	}
 
-	bool Has(EntityId e) const override
+	T* TryGet(EntityId e)
+	{
+		const std::uint32_t idx = IndexOf(e);
+		return (idx != kNpos) ? &At(idx) : nullptr;
+	}
+
+	const T* TryGet(EntityId e) const
+	{
+		const std::uint32_t idx = IndexOf(e);
+		return (idx != kNpos) ? &At(idx) : nullptr;
+	}
+
+	void SwapAt(std::uint32_t a, std::uint32_t b) override
+	{
+		if (a == b)
+		{
+			return;
+		}
+		using std::swap;
+		swap(At(a), At(b));
+		swap(m_ticks[a], m_ticks[b]);
+		SparseSet::SwapAt(a, b);
+	}
+
+	/// dense  i Ԗڂ tick ŕύXς݂ɂ
+	void MarkChangedAt(std::size_t i, std::uint32_t tick) { m_ticks[i] = tick; }
+
+	/// dense  i ԖڂŌɕύXꂽeBbN
+	std::uint32_t ChangedTickAt(std::size_t i) const { return m_ticks[i]; }
+
+	/// e ̃R|[lg since ɕύXꂽiĂȂ falsej
+	bool ChangedSince(EntityId e, std::uint32_t since) const
 	{
-		return (data.find(e) != data.end());
+		const std::uint32_t idx = IndexOf(e);
+		return (idx != kNpos) && (m_ticks[idx] > since);
 	}
+
+	/// dense  i Ԗڂ̃R|[lg
+	T& At(std::size_t i) { return *reinterpret_cast<T*>(&m_pages[i / kDensePageSize][i % kDensePageSize]); }
+	const T& At(std::size_t i) const { return *reinterpret_cast<const T*>(&m_pages[i / kDensePageSize][i % kDensePageSize]); }
+
+private:
+	/// T 1u関̈
+	using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	struct PageDeleter
+	{
+		void operator()(Slot* p) const { ::operator delete(p); }
+	};
+
+private:
+	/// R|[lg{́iy[WEy[W͘Aj
+	std::vector<std::unique_ptr<Slot[], PageDeleter>> m_pages;
+
+	/// dense Ɠт̕ύXeBbN
+	std::vector<std::uint32_t> m_ticks;
+};
+
+/**
+ * @brief View/ParallelView ɓnύXtB^
+ * @details
+ * T  since eBbNɕύXꂽGeBeBR[obNɓn܂B
+ * @code
+ * world.View<const TransformComponent, const ModelRendererComponent>(
+ *     Changed<TransformComponent>{ m_lastTick },
+ *     [&](EntityId e, const TransformComponent& tr, const ModelRendererComponent& mr) { ... });
+ * m_lastTick = world.CurrentTick();
+ * @endcode
+ */
+template <class T>
+struct Changed
+{
+	std::uint32_t since = 0; ///< ̃eBbN̕ύXʂ
 };
 
 /**
@@ -49,14 +303,24 @@ struct ComponentStorage final : public IComponentStorage
  * - R|[lg̒ǉ/폜/擾
  * - R|[lgGeBeB̈ꊇ(View)
  * ܂Ƃ߂čsNXłB
+ *
+ * ύXo:
+ * World ̓t[ƂɐiރeBbN(CurrentTick)AR|[lg
+ * \Ȍ`ŐGƂiAdd / const  GetETryGet / View Ŕconst ^ƂĎ󂯎j
+ * ̃eBbNL^܂Bǂނ View ͌^ const Ŏw肵Ă
+ * i: View<const TransformComponent, ...>jBconst Ŏw肵^͕ύXɂȂ܂B
  */
 class World
 {
 public:
 	World()
+		: m_commands(*this)
 	{
 	}
 
+	World(const World&) = delete;
+	World& operator=(const World&) = delete;
+
 	//==================================================================
 	// GeBeBǗ
 	//==================================================================
@@ -64,28 +328,81 @@ public:
 	/**
 	 * @brief VGeBeB𐶐
 	 * @return ꂽGeBeBID
+	 * @details
+	 * jς݂̃Xbgΐi߂čėp܂B
 	 */
 	EntityId Create()
 	{
-		if (m_next == kInvalidEntity)
+		if (!m_freeSlots.empty())
+		{
+			const std::uint32_t index = m_freeSlots.back();
+			m_freeSlots.pop_back();
+			EntitySlot& slot = m_slots[index];
+			slot.alive = true;
+			slot.mask.Clear();
+			return slot.id;
+		}
+
+		if (m_slots.empty())
 		{
-			m_next = 1;
+			m_slots.emplace_back(); // Xbg0 kInvalidEntity pɌ
 		}
-		return m_next++;
+		const std::uint32_t index = static_cast<std::uint32_t>(m_slots.size());
+		assert(index <= kEntityIndexMask && "Create: too many entities");
+
+		EntitySlot slot;
+		slot.id = MakeEntityId(index, 0);
+		slot.alive = true;
+		m_slots.push_back(slot);
+		return slot.id;
 	}
 
 	/**
 	 * @brief w肵GeBeBj
 	 * @param e jGeBeBID
 	 * @details
-	 * o^Ă邷ׂẴR|[lgXg[WÃGeBeBɕRÂf[^폜܂B
+	 * R|[lg}XNɗĂXg[W炾f[^폜A
+	 * Xbg͐i߂ăt[Xgɖ߂܂B
+	 * ɔjς݁iÂjIDȂ牽܂B
 	 */
 	void Destroy(EntityId e)
 	{
-		for (auto& kv : m_storages)
+		if (!IsAlive(e))
 		{
-			kv.second->Remove(e);
+			return;
 		}
+
+		const std::uint32_t index = EntityIndex(e);
+		m_slots[index].mask.ForEach([&](std::size_t bit)
+			{
+				LeaveGroups(static_cast<ComponentType>(bit), e);
+				m_storages[bit]->Remove(e);
+			});
+
+		EntitySlot& slot = m_slots[index];
+		slot.mask.Clear();
+		slot.alive = false;
+		slot.id = MakeEntityId(index, EntityVersion(e) + 1);
+		m_freeSlots.push_back(index);
+	}
+
+	/**
+	 * @brief IDݐ̃GeBeBwĂ邩
+	 * @details jɍėpꂽXbgwÂID false ɂȂ܂B
+	 */
+	bool IsAlive(EntityId e) const
+	{
+		const std::uint32_t index = EntityIndex(e);
+		return (index != 0 && index < m_slots.size() && m_slots[index].alive && m_slots[index].id == e);
+	}
+
+	/**
+	 * @brief GeBeBR|[lg^̏W擾
+	 */
+	const ComponentMask& GetMask(EntityId e) const
+	{
+		assert(IsAlive(e) && "GetMask: entity is not alive");
+		return m_slots[EntityIndex(e)].mask;
 	}
 
 	//==================================================================
@@ -95,36 +412,36 @@ public:
 	template <class T, class... Args>
 	T& Add(EntityId e, Args &&...args)
 	{
+		assert(IsAlive(e) && "Add<T>: entity is not alive");
 		auto& s = storage<T>();
-		auto it = s.find(e);
-
-		if (it == s.end())
+		const ComponentType id = ComponentFamily::Id<T>();
+		const bool isNew = !s.Has(e);
+		m_slots[EntityIndex(e)].mask.Set(id);
+		s.Emplace(e, std::forward<Args>(args)...);
+		if (isNew)
 		{
-			it = s.emplace(e, T{ std::forward<Args>(args)... }).first;
+			// LO[vɓ dense œւ̂ŁAQƂ͍ŌɈ
+			JoinGroups(id, e);
 		}
-		else
-		{
-			it->second = T{ std::forward<Args>(args)... };
-		}
-
-		return it->second;
+		const std::uint32_t idx = s.IndexOf(e);
+		s.MarkChangedAt(idx, m_tick);
+		return s.At(idx);
 	}
 
 	template <class T>
 	bool Has(EntityId e) const
 	{
 		const auto* s = find<T>();
-		return (s && s->count(e) != 0);
+		return (s && s->Has(e));
 	}
 
+	/// const ł͎擾_ŕύXɂȂ
 	template <class T>
 	T& Get(EntityId e)
 	{
-		auto* s = find<T>();
-		assert(s && "Get<T>: storage not found");
-		auto it = s->find(e);
-		assert(it != s->end() && "Get<T>: entity doesn't have T");
-		return it->second;
+		T* p = TryGet<T>(e);
+		assert(p && "Get<T>: entity doesn't have T");
+		return *p;
 	}
 
 	template <class T>
@@ -132,11 +449,12 @@ public:
 	{
 		const auto* s = find<T>();
 		assert(s && "Get<T> const: storage not found");
-		auto it = s->find(e);
-		assert(it != s->end() && "Get<T> const: entity doesn't have T");
-		return it->second;
+		const T* p = s->TryGet(e);
+		assert(p && "Get<T> const: entity doesn't have T");
+		return *p;
 	}
 
+	/// const ł͎擾ł_ŕύXɂȂ
 	template <class T>
 	T* TryGet(EntityId e)
 	{
@@ -145,80 +463,275 @@ public:
 		{
 			return nullptr;
 		}
-		auto it = s->find(e);
-		if (it == s->end())
+		const std::uint32_t idx = s->IndexOf(e);
+		if (idx == SparseSet::kNpos)
 		{
 			return nullptr;
 		}
-		return &it->second;
+		s->MarkChangedAt(idx, m_tick);
+		return &s->At(idx);
 	}
 
 	template <class T>
 	const T* TryGet(EntityId e) const
 	{
 		const auto* s = find<T>();
-		if (!s)
-		{
-			return nullptr;
-		}
-		auto it = s->find(e);
-		if (it == s->end())
+		return s ? s->TryGet(e) : nullptr;
+	}
+
+	template <class T>
+	void Remove(EntityId e)
+	{
+		auto* s = find<T>();
+		if (s && s->Has(e))
 		{
-			return nullptr;
+			LeaveGroups(ComponentFamily::Id<T>(), e);
+			s->Remove(e);
+			m_slots[EntityIndex(e)].mask.Reset(ComponentFamily::Id<T>());
 		}
-		return &it->second;
 	}
 
+	//==================================================================
+	// ύXo
+	//==================================================================
+
+	/// ݂̃eBbNiSystemRegistry::Render ̍Ō1iށj
+	std::uint32_t CurrentTick() const { return m_tick; }
+
+	/// eBbNi߂iʏ SystemRegistry 1t[1Ăԁj
+	void AdvanceTick() { ++m_tick; }
+
+	/// e  T  since eBbNɕύXꂽ
 	template <class T>
-	void Remove(EntityId e)
+	bool IsChangedSince(EntityId e, std::uint32_t since) const
+	{
+		const auto* s = find<T>();
+		return s && s->ChangedSince(e, since);
+	}
+
+	/**
+	 * @brief T ύXς݂ɂ
+	 * @details const Ŏ󂯎ɏȂꍇȂǂɖIɌĂт܂B
+	 */
+	template <class T>
+	void MarkChanged(EntityId e)
 	{
 		auto* s = find<T>();
-		if (s)
+		const std::uint32_t idx = s ? s->IndexOf(e) : SparseSet::kNpos;
+		if (idx != SparseSet::kNpos)
 		{
-			s->erase(e);
+			s->MarkChangedAt(idx, m_tick);
 		}
 	}
 
+	/// ς݃XbgiEntityIndex(e) ͂ꖢɂȂj
+	std::size_t EntityCapacity() const { return m_slots.size(); }
+
 	//==================================================================
 	// View
 	//==================================================================
 
+	/**
+	 * @brief A  Rest ׂĎGeBeB𑖍
+	 * @details
+	 * ΏۃXg[WŏɈxA̒ŗvfŏ̂̂N_ɑ܂B
+	 * ̃R|[lg͉ς݃Xg[W sparse 𒼐ڈ̂ŁA^̍ĉ͔܂B
+	 * N_Xg[W͖擪֌đ邽߁A
+	 * R[obNō̃GeBeB Destroy/Remove ĂA
+	 * lߒňڂĂ̂͑ς݂̗vfȂ̂Ŏ肱ڂ͋N܂B
+	 * ^ const Ŏw肵́iView<const TransformComponent, ...>j͕ύXɂȂ܂B
+	 */
 	template <class A, class... Rest, class Fn>
 	void View(Fn&& fn)
 	{
-		auto* sa = find<A>();
-		if (!sa)
+		Each(FindGroup<A, Rest...>(), AcceptAll{}, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, std::index_sequence_for<A, Rest...>{});
+	}
+
+	template <class A, class... Rest, class Fn>
+	void View(Fn&& fn) const
+	{
+		Each(FindGroup<A, Rest...>(), AcceptAll{}, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, std::index_sequence_for<A, Rest...>{});
+	}
+
+	/**
+	 * @brief View ̂AC  filter.since ɕύXꂽGeBeB𑖍
+	 */
+	template <class A, class... Rest, class C, class Fn>
+	void View(const Changed<C>& filter, Fn&& fn)
+	{
+		const auto* changed = find<C>();
+		if (changed)
 		{
-			return;
+			Each(FindGroup<A, Rest...>(), ChangedFilter<C>{ changed, filter.since }, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, std::index_sequence_for<A, Rest...>{});
 		}
+	}
 
-		for (auto& kv : *sa)
+	template <class A, class... Rest, class C, class Fn>
+	void View(const Changed<C>& filter, Fn&& fn) const
+	{
+		const auto* changed = find<C>();
+		if (changed)
 		{
-			const EntityId e = kv.first;
-			if (has_all_rest<Rest...>(e))
-			{
-				fn(e, Get<A>(e), Get<Rest>(e)...);
-			}
+			Each(FindGroup<A, Rest...>(), ChangedFilter<C>{ changed, filter.since }, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, std::index_sequence_for<A, Rest...>{});
 		}
 	}
 
+	/**
+	 * @brief A  Rest ׂĎGeBeBAWuv[ŕđ
+	 * @param fn    void(EntityId, A&, Rest&...)BXbh瓯ɌĂ΂
+	 * @param grain 1`ŇB0 ȂXbh玩
+	 * @details
+	 * N_Xg[W(O[v΂͈̔) dense z`Nɐ؂ JobSystem ɗA
+	 * S`NI܂Ŗ߂܂BR[obNɂ͎̐񂪂܂B
+	 * - ł悢͈̂œnꂽũGeBeBgṽR|[lg
+	 * - GeBeB̃R|[lg͓ǂݎ̂݁i̊ԁANȂOj
+	 * - World  Destroy/Add/Remove ͒ڌĂ΂ Commands() ɐς
+	 * - GeBeB̐͂łȂiCommands().Create() sB̑Oōsj
+	 * - Ăяo͕sBʂW߂ꍇ͏o͐XbhƂɕ邩 atomic g
+	 */
 	template <class A, class... Rest, class Fn>
-	void View(Fn&& fn) const
+	void ParallelView(Fn&& fn, std::size_t grain = 0)
+	{
+		ParallelEach(FindGroup<A, Rest...>(), AcceptAll{}, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, grain, std::index_sequence_for<A, Rest...>{});
+	}
+
+	template <class A, class... Rest, class Fn>
+	void ParallelView(Fn&& fn, std::size_t grain = 0) const
+	{
+		ParallelEach(FindGroup<A, Rest...>(), AcceptAll{}, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, grain, std::index_sequence_for<A, Rest...>{});
+	}
+
+	/**
+	 * @brief ParallelView ̂AC  filter.since ɕύXꂽGeBeB𑖍
+	 */
+	template <class A, class... Rest, class C, class Fn>
+	void ParallelView(const Changed<C>& filter, Fn&& fn, std::size_t grain = 0)
 	{
-		const auto* sa = find<A>();
-		if (!sa)
+		const auto* changed = find<C>();
+		if (changed)
+		{
+			ParallelEach(FindGroup<A, Rest...>(), ChangedFilter<C>{ changed, filter.since }, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, grain, std::index_sequence_for<A, Rest...>{});
+		}
+	}
+
+	template <class A, class... Rest, class C, class Fn>
+	void ParallelView(const Changed<C>& filter, Fn&& fn, std::size_t grain = 0) const
+	{
+		const auto* changed = find<C>();
+		if (changed)
+		{
+			ParallelEach(FindGroup<A, Rest...>(), ChangedFilter<C>{ changed, filter.since }, fn, std::make_tuple(find<A>(), find<Rest>()...), m_tick, grain, std::index_sequence_for<A, Rest...>{});
+		}
+	}
+
+	/**
+	 * @brief A  Rest ׂĎGeBeB̐Ԃ
+	 */
+	template <class A, class... Rest>
+	std::size_t Count() const
+	{
+		if (const GroupData* g = FindGroup<A, Rest...>())
+		{
+			return g->size;
+		}
+		std::size_t n = 0;
+		View<A, Rest...>([&n](EntityId, const A&, const Rest&...) { ++n; });
+		return n;
+	}
+
+	//==================================================================
+	// xR}h
+	//==================================================================
+
+	/**
+	 * @brief \ύX񂵂ɂR}hobt@
+	 * @details
+	 * View ̃R[obNȂǁA Destroy/Add/Remove Ƃ͂ɐς݂܂B
+	 * SystemRegistry::Tick e System ̎s FlushCommands() Ŕf܂B
+	 * ParallelView ̃R[obNς߂̂ Destroy/Add/Remove łB
+	 */
+	CommandBuffer& Commands() { return m_commands; }
+
+	/// ς܂ꂽR}h܂Ƃ߂Ĕfi_j
+	void FlushCommands() { m_commands.Flush(); }
+
+	//==================================================================
+	// O[v
+	//==================================================================
+
+	/**
+	 * @brief 悭gR|[lg̑gݍ킹uO[vvƂĐ錾
+	 * @details
+	 * ܂̃O[vɏLĂȂXg[W̃O[vLA
+	 * Ts ׂĎGeBeBLXg[W̐擪 [0, size) ɓԂŋl߂ĕێ܂B
+	 * т Add/Remove/Destroy ̂тɈێ̂ŁA
+	 * ȍ~ View<Ts...>isj͏Ȃł͈̔͂`r߂邾ɂȂ܂B
+	 * LłȂXg[WiO[vLj̗vf sparse oRň܂B
+	 *
+	 * 1̃Xg[WLłO[v1łB
+	 * Œ1͏LłXg[WcĂKv܂B
+	 */
+	template <class... Ts>
+	void DeclareGroup()
+	{
+		static_assert(sizeof...(Ts) >= 2, "DeclareGroup: need at least two component types");
+		if (FindGroup<Ts...>())
+		{
+			return;
+		}
+
+		auto g = std::make_unique<GroupData>();
+		g->typeCount = sizeof...(Ts);
+		const ComponentType ids[] = { ComponentFamily::Id<Ts>()... };
+		SparseSet* pools[] = { &storage<Ts>()... };
+		for (std::size_t k = 0; k < sizeof...(Ts); ++k)
+		{
+			g->types.Set(ids[k]);
+			if (!m_ownedTypes.Test(ids[k]))
+			{
+				g->owned.Set(ids[k]);
+				g->ownedPools.push_back(pools[k]);
+			}
+		}
+		assert(!g->ownedPools.empty() && "DeclareGroup: every storage is already owned by another group");
+		if (g->ownedPools.empty())
 		{
 			return;
 		}
+		for (std::size_t k = 0; k < sizeof...(Ts); ++k)
+		{
+			if (g->owned.Test(ids[k]))
+			{
+				m_ownedTypes.Set(ids[k]);
+			}
+			if (ids[k] >= m_groupsByType.size())
+			{
+				m_groupsByType.resize(ids[k] + 1);
+			}
+			m_groupsByType[ids[k]].push_back(g.get());
+		}
 
-		for (const auto& kv : *sa)
+		// GeBeB荞
+		const SparseSet* lead = pools[0];
+		for (const SparseSet* p : pools)
+		{
+			lead = (p->Size() < lead->Size()) ? p : lead;
+		}
+		std::vector<EntityId> members;
+		for (std::size_t i = 0; i < lead->Size(); ++i)
 		{
-			const EntityId e = kv.first;
-			if (has_all_rest<Rest...>(e))
+			const EntityId e = lead->EntityAt(i);
+			if (m_slots[EntityIndex(e)].mask.ContainsAll(g->types))
 			{
-				fn(e, Get<A>(e), Get<Rest>(e)...);
+				members.push_back(e);
 			}
 		}
+		for (EntityId e : members)
+		{
+			g->Insert(e);
+		}
+
+		m_groups.push_back(std::move(g));
 	}
 
 private:
@@ -227,61 +740,407 @@ private:
 	//==================================================================
 
 	template <class T>
-	std::unordered_map<EntityId, T>& storage()
+	ComponentStorage<T>& storage()
 	{
-		ComponentType key = std::type_index(typeid(T));
-		auto it = m_storages.find(key);
+		const ComponentType id = ComponentFamily::Id<T>();
+		assert(id < kMaxComponentTypes && "storage<T>: too many component types");
 
-		if (it == m_storages.end())
+		if (id >= m_storages.size())
+		{
+			m_storages.resize(id + 1);
+		}
+		if (!m_storages[id])
 		{
-			auto ptr = std::unique_ptr<IComponentStorage>(new ComponentStorage<T>());
-			it = m_storages.emplace(key, std::move(ptr)).first;
+			m_storages[id].reset(new ComponentStorage<T>());
 		}
 
-		return static_cast<ComponentStorage<T> *>(it->second.get())->data;
+		return *static_cast<ComponentStorage<T> *>(m_storages[id].get());
 	}
 
+	/// T  const CĂΓǂݎp̃Xg[WƂĕԂ
 	template <class T>
-	std::unordered_map<EntityId, T>* find()
+	using StorageFor = typename std::conditional<std::is_const<T>::value,
+		const ComponentStorage<typename std::remove_const<T>::type>,
+		ComponentStorage<T>>::type;
+
+	template <class T>
+	StorageFor<T>* find()
 	{
-		ComponentType key = std::type_index(typeid(T));
-		auto it = m_storages.find(key);
-		if (it == m_storages.end())
+		const ComponentType id = ComponentFamily::Id<typename std::remove_const<T>::type>();
+		return (id < m_storages.size()) ? static_cast<StorageFor<T> *>(m_storages[id].get()) : nullptr;
+	}
+
+	template <class T>
+	const ComponentStorage<typename std::remove_const<T>::type>* find() const
+	{
+		const ComponentType id = ComponentFamily::Id<typename std::remove_const<T>::type>();
+		return (id < m_storages.size()) ? static_cast<const ComponentStorage<typename std::remove_const<T>::type> *>(m_storages[id].get()) : nullptr;
+	}
+
+	/**
+	 * @brief DeclareGroup ōꂽO[v̏
+	 * @details
+	 * o[͏LXg[W(ownedPools) dense 擪 [0, size) ɓтŒu܂B
+	 */
+	struct GroupData
+	{
+		ComponentMask types;                 ///< O[v\S^
+		ComponentMask owned;                 ///< ̃O[vтLĂ^
+		std::size_t typeCount = 0;           ///< S^̐
+		std::vector<SparseSet*> ownedPools;  ///< LXg[Wi擪̋N_j
+		std::size_t size = 0;                ///< o[
+
+		bool Contains(EntityId e) const
+		{
+			const std::uint32_t idx = ownedPools.front()->IndexOf(e);
+			return idx != SparseSet::kNpos && idx < size;
+		}
+
+		/// eLXg[W e  [size] ̈ʒuֈڂăo[ɉ
+		void Insert(EntityId e)
+		{
+			for (SparseSet* p : ownedPools)
+			{
+				p->SwapAt(p->IndexOf(e), static_cast<std::uint32_t>(size));
+			}
+			++size;
+		}
+
+		/// eLXg[W e  [size-1] ̈ʒuֈڂăo[O
+		void Evict(EntityId e)
+		{
+			--size;
+			for (SparseSet* p : ownedPools)
+			{
+				p->SwapAt(p->IndexOf(e), static_cast<std::uint32_t>(size));
+			}
+		}
+	};
+
+	/// ^ id ̃R|[lgtɁA𖞂O[v e 
+	void JoinGroups(ComponentType id, EntityId e)
+	{
+		if (id >= m_groupsByType.size())
+		{
+			return;
+		}
+		const ComponentMask& mask = m_slots[EntityIndex(e)].mask;
+		for (GroupData* g : m_groupsByType[id])
+		{
+			if (!g->Contains(e) && mask.ContainsAll(g->types))
+			{
+				g->Insert(e);
+			}
+		}
+	}
+
+	/// ^ id ̃R|[lgOOɁAe ֌WO[vO
+	void LeaveGroups(ComponentType id, EntityId e)
+	{
+		if (id >= m_groupsByType.size())
+		{
+			return;
+		}
+		for (GroupData* g : m_groupsByType[id])
+		{
+			if (g->Contains(e))
+			{
+				g->Evict(e);
+			}
+		}
+	}
+
+	/// ^̏W Ts ƈvO[vTisj
+	template <class... Ts>
+	const GroupData* FindGroup() const
+	{
+		if (m_groups.empty())
 		{
 			return nullptr;
 		}
-		return &static_cast<ComponentStorage<T> *>(it->second.get())->data;
+		const ComponentType first = ComponentFamily::Id<typename std::remove_const<typename std::tuple_element<0, std::tuple<Ts...>>::type>::type>();
+		if (first >= m_groupsByType.size())
+		{
+			return nullptr;
+		}
+		for (const GroupData* g : m_groupsByType[first])
+		{
+			if (g->typeCount == sizeof...(Ts) && (g->types.Test(ComponentFamily::Id<typename std::remove_const<Ts>::type>()) && ...))
+			{
+				return g;
+			}
+		}
+		return nullptr;
 	}
 
-	template <class T>
-	const std::unordered_map<EntityId, T>* find() const
+	/// tB^Ȃ
+	struct AcceptAll
 	{
-		ComponentType key = std::type_index(typeid(T));
-		auto it = m_storages.find(key);
-		if (it == m_storages.end())
+		bool operator()(EntityId) const { return true; }
+	};
+
+	/// Changed<C> tB^̎
+	template <class C>
+	struct ChangedFilter
+	{
+		const ComponentStorage<typename std::remove_const<C>::type>* storage;
+		std::uint32_t since;
+
+		bool operator()(EntityId e) const { return storage->ChangedSince(e, since); }
+	};
+
+	/// const Ŏ󂯎Xg[WȂ dense  i ԖڂύXς݂ɂ
+	template <class S>
+	static void MarkAt(S* pool, std::size_t i, std::uint32_t tick)
+	{
+		if constexpr (!std::is_const<S>::value)
+		{
+			pool->MarkChangedAt(i, tick);
+		}
+	}
+
+	/// pools[I]  dense ̓Y܂Ƃ߂ĉiN_ lead ƓȂ i ̂܂܎gj
+	template <class... Pools, std::size_t... I>
+	static bool ResolveAll(const SparseSet* lead, std::size_t i, EntityId e, const std::tuple<Pools*...>& pools, std::uint32_t (&idx)[sizeof...(I)], std::index_sequence<I...>)
+	{
+		((idx[I] = (static_cast<const SparseSet*>(std::get<I>(pools)) == lead)
+			? static_cast<std::uint32_t>(i)
+			: std::get<I>(pools)->IndexOf(e)), ...);
+		return ((idx[I] != SparseSet::kNpos) && ...);
+	}
+
+	/**
+	 * @brief pools ̂vfŏ̂̂Ԃi1łȂ nullptrj
+	 */
+	template <class... Pools, std::size_t... I>
+	static const SparseSet* SmallestPool(const std::tuple<Pools*...>& pools, std::index_sequence<I...>)
+	{
+		if (((std::get<I>(pools) == nullptr) || ...))
 		{
 			return nullptr;
 		}
-		return &static_cast<const ComponentStorage<T> *>(it->second.get())->data;
+
+		const SparseSet* lead = std::get<0>(pools);
+		((lead = (std::get<I>(pools)->Size() < lead->Size()) ? std::get<I>(pools) : lead), ...);
+		return lead;
 	}
 
-	template <class... Ts>
-	typename std::enable_if<sizeof...(Ts) == 0, bool>::type
-		has_all_rest(EntityId) const
+	/**
+	 * @brief View ̖{
+	 * @details
+	 * O[v΂͈̔͂`ɁA΍ŏXg[WN_ɑ܂B
+	 * O[v̏L^͓Y iA񏊗L^ sparse 𒼐ڈ܂iK݂jB
+	 * pred ʂGeBeBAconst ^ύXς݂ɂĂ fn Ăт܂B
+	 */
+	template <class Pred, class Fn, class... Pools, std::size_t... I>
+	static void Each(const GroupData* g, const Pred& pred, Fn& fn, const std::tuple<Pools*...>& pools, std::uint32_t tick, std::index_sequence<I...>)
 	{
-		return true;
+		if (g)
+		{
+			const SparseSet* lead = g->ownedPools.front();
+			const bool owned[] = { g->owned.Test(ComponentFamily::Id<typename std::remove_const<typename std::remove_pointer<Pools>::type>::type::ValueType>())... };
+
+			for (std::size_t i = g->size; i-- > 0;)
+			{
+				if (i >= g->size)
+				{
+					continue; // R[obNŕOꂽꍇ
+				}
+
+				const EntityId e = lead->EntityAt(i);
+				if (!pred(e))
+				{
+					continue;
+				}
+				const std::uint32_t idx[] = { owned[I] ? static_cast<std::uint32_t>(i) : std::get<I>(pools)->IndexOf(e)... };
+				(MarkAt(std::get<I>(pools), idx[I], tick), ...);
+				fn(e, std::get<I>(pools)->At(idx[I])...);
+			}
+			return;
+		}
+
+		// ŏ̃Xg[WN_ɂBꂩȂ}b`GeBeB݂͑Ȃ
+		const SparseSet* lead = SmallestPool(pools, std::index_sequence<I...>{});
+		if (!lead)
+		{
+			return;
+		}
+
+		for (std::size_t i = lead->Size(); i-- > 0;)
+		{
+			if (i >= lead->Size())
+			{
+				continue; // R[obNŕ폜ꂽꍇ
+			}
+
+			const EntityId e = lead->EntityAt(i);
+			std::uint32_t idx[sizeof...(I)];
+			if (ResolveAll(lead, i, e, pools, idx, std::index_sequence<I...>{}) && pred(e))
+			{
+				(MarkAt(std::get<I>(pools), idx[I], tick), ...);
+				fn(e, std::get<I>(pools)->At(idx[I])...);
+			}
+		}
 	}
 
-	template <class T1, class... Ts>
-	bool has_all_rest(EntityId e) const
+	/**
+	 * @brief ParallelView ̖{
+	 * @details
+	 * ɍ\ύXNȂOȂ̂ŁAView ƈႢOf [begin, end) r߂܂B
+	 */
+	template <class Pred, class Fn, class... Pools, std::size_t... I>
+	static void ParallelEach(const GroupData* g, const Pred& pred, Fn& fn, const std::tuple<Pools*...>& pools, std::uint32_t tick, std::size_t grain, std::index_sequence<I...>)
 	{
-		return Has<T1>(e) && has_all_rest<Ts...>(e);
+		if (g)
+		{
+			const SparseSet* lead = g->ownedPools.front();
+			const bool owned[] = { g->owned.Test(ComponentFamily::Id<typename std::remove_const<typename std::remove_pointer<Pools>::type>::type::ValueType>())... };
+
+			JobSystem::ParallelFor(g->size, grain, [&](std::size_t begin, std::size_t end)
+				{
+					for (std::size_t i = begin; i < end; ++i)
+					{
+						const EntityId e = lead->EntityAt(i);
+						if (!pred(e))
+						{
+							continue;
+						}
+						const std::uint32_t idx[] = { owned[I] ? static_cast<std::uint32_t>(i) : std::get<I>(pools)->IndexOf(e)... };
+						(MarkAt(std::get<I>(pools), idx[I], tick), ...);
+						fn(e, std::get<I>(pools)->At(idx[I])...);
+					}
+				});
+			return;
+		}
+
+		const SparseSet* lead = SmallestPool(pools, std::index_sequence<I...>{});
+		if (!lead)
+		{
+			return;
+		}
+
+		JobSystem::ParallelFor(lead->Size(), grain, [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					const EntityId e = lead->EntityAt(i);
+					std::uint32_t idx[sizeof...(I)];
+					if (ResolveAll(lead, i, e, pools, idx, std::index_sequence<I...>{}) && pred(e))
+					{
+						(MarkAt(std::get<I>(pools), idx[I], tick), ...);
+						fn(e, std::get<I>(pools)->At(idx[I])...);
+					}
+				}
+			});
 	}
 
 private:
-	/// eR|[lg^ɑΉXg[W
-	std::unordered_map<ComponentType, std::unique_ptr<IComponentStorage>> m_storages;
+	/// eR|[lg^ɑΉXg[WiY = ComponentFamily::Id<T>()j
+	std::vector<std::unique_ptr<IComponentStorage>> m_storages;
+
+	/// 錾ς݃O[v
+	std::vector<std::unique_ptr<GroupData>> m_groups;
+
+	/// ^ID  ̌^܂ރO[v
+	std::vector<std::vector<GroupData*>> m_groupsByType;
 
-	/// Ɋ蓖ĂGeBeBID
-	EntityId m_next = kInvalidEntity;
+	/// ꂩ̃O[vɏLĂ^
+	ComponentMask m_ownedTypes;
+
+	/// GeBeB1Ԃ̊Ǘ
+	struct EntitySlot
+	{
+		EntityId      id = kInvalidEntity; ///< (܂͎)̐㍞ID
+		bool          alive = false;       ///< 
+		ComponentMask mask;                ///< ĂR|[lg^
+	};
+
+	/// Xbgԍ  Ǘ
+	std::vector<EntitySlot> m_slots;
+
+	/// ėp҂̃Xbgԍ
+	std::vector<std::uint32_t> m_freeSlots;
+
+	/// ύXop̃eBbNi0 ́uxύXĂȂvȂ̂ 1 j
+	std::uint32_t m_tick = 1;
+
+	/// xR}h
+	CommandBuffer m_commands;
 };
+
+//======================================================================
+// CommandBuffer  World Ɉˑ镔
+//======================================================================
+
+inline EntityId CommandBuffer::Create()
+{
+	// ID mۂ World ̃XbgzL΂̂ŁA[J[ĂԂƓǂݎƋ
+	assert(std::this_thread::get_id() == m_ownerThread && "CommandBuffer::Create: not allowed from worker threads");
+	return m_world.Create();
+}
+
+inline void CommandBuffer::Destroy(EntityId e)
+{
+	Push(kDestroyOrder, e, [](World& w, EntityId id, void*) { w.Destroy(id); }, nullptr, nullptr);
+}
+
+template <class T, class... Args>
+void CommandBuffer::Add(EntityId e, Args&&... args)
+{
+	T* value = new T{ std::forward<Args>(args)... };
+	Push(ComponentFamily::Id<T>(), e,
+		[](World& w, EntityId id, void* p)
+		{
+			if (w.IsAlive(id))
+			{
+				w.Add<T>(id, std::move(*static_cast<T*>(p)));
+			}
+		},
+		[](void* p) { delete static_cast<T*>(p); },
+		value);
+}
+
+template <class T>
+void CommandBuffer::Remove(EntityId e)
+{
+	Push(ComponentFamily::Id<T>(), e,
+		[](World& w, EntityId id, void*)
+		{
+			if (w.IsAlive(id))
+			{
+				w.Remove<T>(id);
+			}
+		},
+		nullptr, nullptr);
+}
+
+inline void CommandBuffer::Flush()
+{
+	if (m_commands.empty())
+	{
+		return;
+	}
+
+	// Kpɐς܂ꂽ͎ɉ񂷂߁AɎoĂ
+	std::vector<Command> batch;
+	{
+		std::lock_guard<std::mutex> lk(m_mutex);
+		batch.swap(m_commands);
+	}
+
+	// Xg[W(^)Ƃɂ܂Ƃ߁A^̒͋L^Bj͍Ō
+	std::sort(batch.begin(), batch.end(),
+		[](const Command& a, const Command& b)
+		{
+			return (a.order != b.order) ? (a.order < b.order) : (a.seq < b.seq);
+		});
+
+	for (auto& c : batch)
+	{
+		c.apply(m_world, c.entity, c.payload);
+		if (c.release)
+		{
+			c.release(c.payload);
+		}
+	}
+}
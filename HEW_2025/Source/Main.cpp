@@ -51,6 +51,7 @@
  // ǉFQ[{
 #include "Game.h"
 #include "System/EffectRuntime.h"
+#include "System/JobSystem.h"
 
 static void PreloadEffectsFromCatalog()
 {
@@ -385,6 +386,9 @@ HRESULT Init(HWND hWnd, UINT width, UINT height)
 
 	AudioManager::Initialize();
 
+    // Wuv[iWorld::ParallelView pj
+    JobSystem::Initialize();
+
     return S_OK;
 }
 
@@ -393,6 +397,8 @@ HRESULT Init(HWND hWnd, UINT width, UINT height)
  */
 void Uninit()
 {
+    JobSystem::Shutdown();
+
     Sprite::Uninit();
     Geometory::Uninit();
     ShaderList::Uninit();
@@ -97,6 +97,15 @@
 #include <DirectXMath.h>
 #include <Windows.h>
 
+namespace
+{
+    /// GamePlayState  SystemRegistry ̃tF[Yrbgɕϊ
+    SystemRegistry::PhaseMask PhaseBit(GamePlayState state)
+    {
+        return 1u << static_cast<std::uint32_t>(state);
+    }
+}
+
 GameScene::GameScene(int stageNo, Difficulty difficulty)
     : m_stageNo(stageNo), m_difficulty(difficulty)
 {
@@ -148,7 +157,8 @@ void GameScene::Initialize()
     m_playerModel = AssetManager::GetModel("mdl_2Pplayer");
     if (m_playerModel)
     {
-        m_playerModel->SetVertexShader(ShaderList::GetVS(ShaderList::VS_WORLD));
+        // vC[̃GeBeBƓfL̂ŁAAj[Vp̃VF[_ɂĂ
+        m_playerModel->SetVertexShader(ShaderList::GetVS(ShaderList::VS_ANIME));
         m_playerModel->SetPixelShader(ShaderList::GetPS(ShaderList::PS_LAMBERT));
     }
     m_groundModel = AssetManager::GetModel("mdl_ground");
@@ -161,25 +171,27 @@ void GameScene::Initialize()
     // -------------------------------------------------------
     // 2. Systemo^
     // -------------------------------------------------------
+    // ł͒ʏvC(Running)B̏Ԃœ͓̂o^ɒǉ
+    m_sys.SetDefaultUpdatePhases(PhaseBit(GamePlayState::Running));
+
     // V[ԃVXe
-    auto& gameStateSys = m_sys.AddUpdate<GameStateSystem>();
-    gameStateSys.Initialize(m_world);
+    m_gameState = &m_sys.AddUpdate<GameStateSystem>();
+    m_gameState->Initialize(m_world);
 
     m_sys.AddUpdate<MovingPlatformSystem>();
     m_sys.AddUpdate<PlayerInputSystem>();
     m_sys.AddUpdate<PlayerUISystem>();
     m_sys.AddUpdate<MovementApplySystem>();
-    m_sys.AddUpdate<PhysicsStepSystem>(&m_colBuf);
+    auto* physics = &m_sys.AddUpdate<PhysicsStepSystem>(&m_colBuf, &m_tileMap);
 
     auto* colSys = &m_sys.AddUpdate<Collision2DSystem>(&m_colBuf);
+    physics->SetStaticColliders(colSys); // ÓIRC_ւ̃XC[vp
+    m_physicsQuery.Bind(colSys, &m_tileMap);
     m_goalSystem = &m_sys.AddUpdate<GoalSystem>(colSys);
 
-    // CWP[^UIVXe
-    m_sys.AddUpdate<PlayerOffscreenIndicatorSystem>();
-    m_sys.AddUpdate<PlayerOffscreenIndicatorFaceSystem>();
-
     // DeathZoneSystemo^ƓՓxp[^ݒ
     m_deathSystem = &m_sys.AddUpdate<DeathZoneSystem>(colSys);
+    m_deathSystem->SetPhysicsQuery(&m_physicsQuery);
 
     // Փxɉ㏸xݒ
     float deathSpeed = 1.0f; // Default (Normal)
@@ -194,18 +206,42 @@ void GameScene::Initialize()
     m_sys.AddUpdate<ModelAnimationStateSystem>();
     m_sys.AddUpdate<ModelAnimationSystem>();
 	m_sys.AddUpdate<PlayerPresentationSystem>();
-    m_sys.AddUpdate<EffectSystem>();
     m_sys.AddUpdate<FollowerSystem>();
     m_followCamera = &m_sys.AddUpdate<FollowCameraSystem>();
 
-    // wi[vVXe
-    m_sys.AddUpdate<BackGroundScrollSystem>();
-
+    // Jm̉oEUIBȉ4͐Gf[^dȂȂ̂œEF[uŕɑ
+    m_sys.AddUpdate<EffectSystem>();
+    m_sys.AddUpdate<PlayerOffscreenIndicatorSystem>();
+    m_sys.AddUpdate<BackGroundScrollSystem>();  // wi[vVXe
     m_sys.AddUpdate<TimerSystem>();
+
+    // CWP[^̊ix[X̃CWP[^XVɒǏ]j
+    m_sys.AddUpdate<PlayerOffscreenIndicatorFaceSystem>();
 	m_sys.AddUpdate<CountdownUISystem>();
     m_sys.AddUpdate<AudioPlaySystem>();
     m_sys.AddUpdate<GameOverUIDelaySystem>();
 
+    // Running ȊȌԂœ System
+    //   Countdown: Aj[VAJA^C}[AI[fBIAJEg_EUI
+    //   PostGoal : on
+    //   GameOver : sko
+    const auto countdown = PhaseBit(GamePlayState::Countdown);
+    const auto postGoal = PhaseBit(GamePlayState::PostGoal);
+    const auto gameOver = PhaseBit(GamePlayState::GameOver);
+    m_sys.AddUpdatePhases<PhysicsStepSystem>(countdown | postGoal);
+    m_sys.AddUpdatePhases<Collision2DSystem>(countdown | postGoal);
+    m_sys.AddUpdatePhases<DeathZoneSystem>(gameOver);
+    m_sys.AddUpdatePhases<PlayerLocomotionStateSystem>(postGoal | gameOver);
+    m_sys.AddUpdatePhases<ModelAnimationStateSystem>(countdown | postGoal | gameOver);
+    m_sys.AddUpdatePhases<ModelAnimationSystem>(countdown | postGoal | gameOver);
+    m_sys.AddUpdatePhases<PlayerPresentationSystem>(postGoal | gameOver);
+    m_sys.AddUpdatePhases<FollowCameraSystem>(countdown | postGoal);
+    m_sys.AddUpdatePhases<EffectSystem>(postGoal);
+    m_sys.AddUpdatePhases<TimerSystem>(countdown);
+    m_sys.AddUpdatePhases<CountdownUISystem>(countdown);
+    m_sys.AddUpdatePhases<AudioPlaySystem>(countdown | postGoal);
+    m_sys.AddUpdatePhases<GameOverUIDelaySystem>(gameOver);
+
     RankingManager::Get().Load("Assets/Save/ranking.json");
 
     m_drawBackGround = &m_sys.AddRender<BackGroundRenderSystem>();
@@ -215,6 +251,12 @@ void GameScene::Initialize()
     m_debugCollision = &m_sys.AddRender<CollisionDebugRenderSystem>();
 #endif
 
+    // t[gݍ킹̓O[vƂċl߂Ă
+    // (Transform ͍ŏɐ錾 Collider2D O[vL)
+    m_world.DeclareGroup<TransformComponent, Collider2DComponent>();
+    m_world.DeclareGroup<TransformComponent, Rigidbody2DComponent>();
+    m_world.DeclareGroup<TransformComponent, ModelRendererComponent>();
+
     // -------------------------------------------------------
     // 3. Xe[W[h (JSON)
     // -------------------------------------------------------
@@ -233,10 +275,10 @@ void GameScene::Initialize()
         // t@CpX
         std::string jsonPath = "Assets/Stages/Stage" + std::to_string(m_stageNo) + "_" + diffStr + ".json";
 
-        bool loadSuccess = loader.Load(jsonPath, m_world, m_prefabs);
+        bool loadSuccess = loader.Load(jsonPath, m_world, m_prefabs, &m_tileMap);
         if (!loadSuccess)
         {
-            loader.Load("Assets/Stages/TestStage2.json", m_world, m_prefabs);
+            loader.Load("Assets/Stages/TestStage2.json", m_world, m_prefabs, &m_tileMap);
         }
     }
 
@@ -277,6 +319,9 @@ void GameScene::Initialize()
         m_prefabs.Spawn("Floor", m_world, sp);
     }
 
+    // ǁEȂǁi^CȊOj̐ÓIRC_̂œ蔻p̊iqgݗĂ
+    colSys->BuildStaticColliders(m_world);
+
     // --- DeathZone ---
     {
         PrefabRegistry::SpawnParams sp;
@@ -468,7 +513,7 @@ void GameScene::Update()
     const float dt = 1.0f / 60.0f;
 
     // V[Ԃ̍XV
-    auto* gs = m_sys.GetUpdate<GameStateSystem>();
+    auto* gs = m_gameState;
     if (gs) gs->Update(m_world, dt);
 
     // ^CA^bNvXVBGMij
@@ -491,52 +536,13 @@ void GameScene::Update()
     // Ԏ擾
     GamePlayState playState = gs ? gs->GetState(m_world) : GamePlayState::Countdown;
 
-    // ԂɉXV
-    switch (playState)
+    // ԂɉXViǂ System 𓮂͓o^ PhaseBit Ŏwς݁j
+    if (playState == GamePlayState::GameOver && m_deathSystem)
     {
-    case GamePlayState::Running:
-        // ʏvCXV
-        m_sys.Tick(m_world, dt);
-        break;
-
-    case GamePlayState::Countdown:
-        // Aj[VAJA^C}[AI[fBÎݍXV
-        if (auto* sys = m_sys.GetUpdate<FollowCameraSystem>())      sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<ModelAnimationSystem>())    sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<AudioPlaySystem>())         sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<TimerSystem>())             sys->Update(m_world, dt);
-		if (auto* sys = m_sys.GetUpdate<Collision2DSystem>())      sys->Update(m_world, dt);
-		if (auto* sys = m_sys.GetUpdate<PhysicsStepSystem>())        sys->Update(m_world, dt);
-		if (auto* sys = m_sys.GetUpdate<CountdownUISystem>())    sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<ModelAnimationStateSystem>()) sys->Update(m_world, dt);
-        break;
-
-    case GamePlayState::PostGoal:
-        // on̂ݍXV
-        if (auto* sys = m_sys.GetUpdate<FollowCameraSystem>())       sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<Collision2DSystem>())      sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<PhysicsStepSystem>())        sys->Update(m_world, dt);
-		if (auto* sys = m_sys.GetUpdate<PlayerLocomotionStateSystem>()) sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<ModelAnimationSystem>())     sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<ModelAnimationStateSystem>())sys->Update(m_world, dt);
-		if (auto* sys = m_sys.GetUpdate<PlayerPresentationSystem>()) sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<EffectSystem>())             sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<AudioPlaySystem>())          sys->Update(m_world, dt);
-        break;
-
-    case GamePlayState::GameOver:
         // skoXVĩfX][VXepj
-		// if (auto* sys = m_sys.GetUpdate<FollowCameraSystem>())        sys->Update(m_world, dt);
-        if (m_deathSystem) m_deathSystem->GameOverUpdate(m_world);
-		if (auto* sys = m_sys.GetUpdate<DeathZoneSystem>())       sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<PlayerLocomotionStateSystem>()) sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<ModelAnimationSystem>())     sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<ModelAnimationStateSystem>())sys->Update(m_world, dt);
-        if (auto* sys = m_sys.GetUpdate<PlayerPresentationSystem>()) sys->Update(m_world, dt);
-        // GameOver UI xXV
-        if (auto* sys = m_sys.GetUpdate<GameOverUIDelaySystem>()) sys->Update(m_world, dt);
-        break;
+        m_deathSystem->GameOverUpdate(m_world);
     }
+    m_sys.Tick(m_world, dt, PhaseBit(playState));
 
     // jÔ݃S[^S̃gK[Ď
     if (playState == GamePlayState::Running)
@@ -40,8 +40,11 @@
 #include "ECS/Prefabs/PrefabPlayer.h"
 #include "ECS/Systems/Update/Audio/AudioPlaySystem.h"
 #include "System/TimeAttackManager.h"
+#include "System/TileCollisionMap.h"
+#include "ECS/Systems/Update/Physics/PhysicsQuery.h"
 
 // O錾
+class GameStateSystem;
 class GoalSystem;
 class DeathZoneSystem;
 class SpriteRenderSystem;
@@ -96,12 +99,17 @@ private:
     CollisionDebugRenderSystem* m_debugCollision = nullptr;
 
     // XVVXe
+    GameStateSystem* m_gameState = nullptr;
     FollowCameraSystem* m_followCamera = nullptr;
     GoalSystem* m_goalSystem = nullptr;
     DeathZoneSystem* m_deathSystem = nullptr;
 
     // ́Eobt@
     CollisionEventBuffer m_colBuf;
+    // n`^C̓iStageLoader APhysicsStepSystem gj
+    TileCollisionMap     m_tileMap;
+    // CLXg̖₢킹iCollision2DSystem ƃ^Cj
+    PhysicsQuery         m_physicsQuery;
 
     // fY
     AssetHandle<Model>   m_playerModel;
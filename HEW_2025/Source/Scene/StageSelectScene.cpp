@@ -122,12 +122,10 @@ void StageSelectScene::Initialize()
         m_playerEntity = m_prefabs.Spawn("Player", m_world, sp);
 
         // Aj[VVXeʂȂ̂ŁAVF[_ÓKpɏ㏑
+        // if͑̃V[ƋLȂ̂ŁÃGeBeBւj
         if (auto* mr = m_world.TryGet<ModelRendererComponent>(m_playerEntity))
         {
-            if (mr->model)
-            {
-                mr->model->SetVertexShader(ShaderList::GetVS(ShaderList::VS_WORLD));
-            }
+            mr->vertexShader = ShaderList::GetVS(ShaderList::VS_WORLD);
         }
 	}
 
@@ -283,9 +283,10 @@ TestScene::TestScene()
     // 2-2 Intent  RigidbodyiEWvEd́j
     m_sys.AddUpdate<MovementApplySystem>();
     // 2-2.5 Rigidbody ̑xʒuɔf镨Xebvid͂ŕωxʒu֓Kpj
-    m_sys.AddUpdate<PhysicsStepSystem>(&m_colBuf);
+    auto* physics = &m_sys.AddUpdate<PhysicsStepSystem>(&m_colBuf);
     // 2-3.1 蔻i߂荞݉Cxgj
     auto* colSys = &m_sys.AddUpdate<Collision2DSystem>(&m_colBuf);
+    physics->SetStaticColliders(colSys); // ÓIRC_ւ̃XC[vp
 
 	// 2-3.2 S[VXeǉ
     m_sys.AddUpdate<GoalSystem>(colSys); // GoalSystemǉ
@@ -443,6 +444,9 @@ TestScene::TestScene()
         m_prefabs.Spawn("Wall", m_world, sp);
     }
 
+    // EǁEubN̂œ蔻p̊iqgݗĂ
+    colSys->BuildStaticColliders(m_world);
+
     //
     // 5. JGeBeB
     //
@@ -103,7 +103,8 @@ TestStageScene::TestStageScene()
     m_playerModel = AssetManager::GetModel("mdl_2Pplayer");
     if (m_playerModel)
     {
-        m_playerModel->SetVertexShader(ShaderList::GetVS(ShaderList::VS_WORLD));
+        // vC[̃GeBeBƓfL̂ŁAAj[Vp̃VF[_ɂĂ
+        m_playerModel->SetVertexShader(ShaderList::GetVS(ShaderList::VS_ANIME));
         m_playerModel->SetPixelShader(ShaderList::GetPS(ShaderList::PS_LAMBERT));
     }
     m_groundModel = AssetManager::GetModel("mdl_ground");
@@ -129,9 +130,10 @@ TestStageScene::TestStageScene()
     // 2-2 Intent  RigidbodyiEWvEd́j
     m_sys.AddUpdate<MovementApplySystem>();
     // 2-2.5 Rigidbody ̑xʒuɔf镨Xebvid͂ŕωxʒu֓Kpj
-    m_sys.AddUpdate<PhysicsStepSystem>(&m_colBuf);
+    auto* physics = &m_sys.AddUpdate<PhysicsStepSystem>(&m_colBuf);
     // 2-3.1 蔻i߂荞݉Cxgj
     auto* colSys = &m_sys.AddUpdate<Collision2DSystem>(&m_colBuf);
+    physics->SetStaticColliders(colSys); // ÓIRC_ւ̃XC[vp
 
     // 2-3.2 S[VXeǉ
     m_goalSystem = &m_sys.AddUpdate<GoalSystem>(colSys); // GoalSystemǉ
@@ -315,6 +317,9 @@ TestStageScene::TestStageScene()
         m_prefabs.Spawn("Timer", m_world, sp);
 	}
 
+    // EǁEXe[W̐ÓIRC_̂œ蔻p̊iqgݗĂ
+    colSys->BuildStaticColliders(m_world);
+
     // 5. JGeBeB
     {
         EntityId camEnt = m_world.Create();
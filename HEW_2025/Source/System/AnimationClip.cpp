@@ -0,0 +1,209 @@
+/*****************************************************************//**
+ * @file   AnimationClip.cpp
+ * @brief  Aj[Vt@C̓ǂݍ݂ƁAiւ̃m[hԍ̊蓖
+ *
+ * @author E
+ * @date   2025/11/28
+ *********************************************************************/
+#include "AnimationClip.h"
+
+#include <algorithm>
+#include <map>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+/*
+* @brief Aj[Vǂݍ
+* @param[in] file ǂݍރAj[Vt@Cւ̃pX
+* @param[out] pError sR
+* @return ǂݍ߂
+*/
+bool AnimationClip::Load(const char* file, std::string* pError)
+{
+	m_source = file;
+	m_totalTime = 0.0f;
+	m_tracks.clear();
+	{
+		std::lock_guard<std::mutex> lock(m_mtxBind);
+		m_bindings.clear();
+	}
+
+	// assimp̐ݒ
+	Assimp::Importer importer;
+	int flag = 0;
+	flag |= aiProcess_Triangulate;
+	flag |= aiProcess_FlipUVs;
+	// n(DirectX)ֈꊇϊBfǂݍݎƑB
+	flag |= aiProcess_ConvertToLeftHanded;
+
+	// assimpœǂݍ
+	const aiScene* pScene = importer.ReadFile(file, flag);
+	if (!pScene)
+	{
+		if (pError) { *pError = importer.GetErrorString(); }
+		return false;
+	}
+
+	// Aj[V`FbN
+	if (!pScene->HasAnimations())
+	{
+		if (pError) { *pError = "no animation."; }
+		return false;
+	}
+
+	// Aj[Vݒ
+	aiAnimation* assimpAnime = pScene->mAnimations[0];
+	float animeFrame = static_cast<float>(assimpAnime->mTicksPerSecond);
+	m_totalTime = static_cast<float>(assimpAnime->mDuration) / animeFrame;
+	m_tracks.resize(assimpAnime->mNumChannels);
+	for (size_t channelIdx = 0; channelIdx < m_tracks.size(); ++channelIdx)
+	{
+		aiNodeAnim* assimpChannel = assimpAnime->mChannels[channelIdx];
+		Track& track = m_tracks[channelIdx];
+		track.nodeName = assimpChannel->mNodeName.data;
+		Model::Timeline& timeline = track.timeline;
+
+		// xXMVECTOR^Ŋi[
+		using XMVectorKey = std::pair<float, DirectX::XMVECTOR>;
+		using XMVectorKeys = std::map<float, DirectX::XMVECTOR>;
+		XMVectorKeys keys[3];
+		// ʒu
+		for (UINT i = 0; i < assimpChannel->mNumPositionKeys; ++i)
+		{
+			aiVectorKey& key = assimpChannel->mPositionKeys[i];
+			keys[0].insert(XMVectorKey(static_cast<float>(key.mTime) / animeFrame,
+				DirectX::XMVectorSet(key.mValue.x, key.mValue.y, key.mValue.z, 0.0f)
+			));
+		}
+		// ]
+		for (UINT i = 0; i < assimpChannel->mNumRotationKeys; ++i)
+		{
+			aiQuatKey& key = assimpChannel->mRotationKeys[i];
+			keys[1].insert(XMVectorKey(static_cast<float>(key.mTime) / animeFrame,
+				DirectX::XMVectorSet(key.mValue.x, key.mValue.y, key.mValue.z, key.mValue.w)));
+		}
+		// gk
+		for (UINT i = 0; i < assimpChannel->mNumScalingKeys; ++i)
+		{
+			aiVectorKey& key = assimpChannel->mScalingKeys[i];
+			keys[2].insert(XMVectorKey(static_cast<float>(key.mTime) / animeFrame,
+				DirectX::XMVectorSet(key.mValue.x, key.mValue.y, key.mValue.z, 0.0f)));
+		}
+
+		// e^CC̐擪̎QƂݒ
+		XMVectorKeys::iterator it[] = { keys[0].begin(), keys[1].begin(), keys[2].begin() };
+		for (int i = 0; i < 3; ++i)
+		{
+			// L[Ȃꍇ́AQƏI
+			if (keys[i].size() == 1)
+				++it[i];
+		}
+
+		// evfƂ̃^CCł͂ȂAׂĂ̕ϊ܂߂^CC̍쐬
+		while (it[0] != keys[0].end() && it[1] != keys[1].end() && it[2] != keys[2].end())
+		{
+			// ̎QƈʒuňԏԂ擾
+			float time = m_totalTime;
+			for (int i = 0; i < 3; i++)
+			{
+				if (it[i] != keys[i].end())
+				{
+					time = std::min(it[i]->first, time);
+				}
+			}
+
+			// ԂɊÂĕԒlvZ
+			DirectX::XMVECTOR result[3];
+			for (int i = 0; i < 3; ++i)
+			{
+				// 擪̃L[菬Ԃł΁A擪̒lݒ
+				if (time < keys[i].begin()->first)
+				{
+					result[i] = keys[i].begin()->second;
+				}
+				// ŏIL[傫Ԃł΁AŏI̒lݒ
+				else if (keys[i].rbegin()->first <= time)
+				{
+					result[i] = keys[i].rbegin()->second;
+					it[i] = keys[i].end();
+				}
+				// L[mɋ܂ꂽԂł΁AԒlvZ
+				else
+				{
+					// QƂĂ鎞ԂƓł΁A̎QƂ
+					if (it[i]->first <= time)
+					{
+						++it[i];
+					}
+
+					// ԒľvZ
+					XMVectorKeys::iterator prev = it[i];
+					--prev;
+					float rate = (time - prev->first) / (it[i]->first - prev->first);
+					result[i] = DirectX::XMVectorLerp(prev->second, it[i]->second, rate);
+				}
+			}
+
+			// w莞ԂɊÂL[ǉ
+			Model::Transform transform;
+			DirectX::XMStoreFloat3(&transform.translate, result[0]);
+			DirectX::XMStoreFloat4(&transform.quaternion, result[1]);
+			DirectX::XMStoreFloat3(&transform.scale, result[2]);
+			timeline.Push(time, transform);
+		}
+	}
+
+	return true;
+}
+
+/*
+* @brief gbNƂ̃m[hԍ擾
+* @param[in] skeleton 蓖Đ̃f
+* @return m_tracks Ɠт̃m[hԍ
+*/
+const AnimationClip::NodeIndices& AnimationClip::GetNodeIndices(const Model& skeleton) const
+{
+	std::lock_guard<std::mutex> lock(m_mtxBind);
+
+	// nbV̍i蓾̂ŁAm[h̕т܂ňv̂g
+	// (unordered_multimap ̗vf͒ǉĂȂ̂ŁAQƂ̂܂ܕԂ)
+	auto range = m_bindings.equal_range(skeleton.m_skeletonKey);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		const Binding& bind = it->second;
+		if (bind.nodeNames.size() != skeleton.m_nodes.size())
+		{
+			continue;
+		}
+		bool same = true;
+		for (size_t i = 0; i < bind.nodeNames.size() && same; ++i)
+		{
+			same = (bind.nodeNames[i] == skeleton.m_nodes[i].name);
+		}
+		if (same)
+		{
+			return bind.indices;
+		}
+	}
+
+	// ̃m[hΐɌg
+	Binding& bind = m_bindings.emplace(skeleton.m_skeletonKey, Binding())->second;
+	std::unordered_map<std::string, Model::NodeIndex> nameToIndex;
+	nameToIndex.reserve(skeleton.m_nodes.size());
+	bind.nodeNames.reserve(skeleton.m_nodes.size());
+	for (size_t i = 0; i < skeleton.m_nodes.size(); ++i)
+	{
+		nameToIndex.emplace(skeleton.m_nodes[i].name, static_cast<Model::NodeIndex>(i));
+		bind.nodeNames.push_back(skeleton.m_nodes[i].name);
+	}
+
+	NodeIndices& indices = bind.indices;
+	indices.resize(m_tracks.size());
+	for (size_t i = 0; i < m_tracks.size(); ++i)
+	{
+		auto it = nameToIndex.find(m_tracks[i].nodeName);
+		indices[i] = (it != nameToIndex.end()) ? it->second : Model::INDEX_NONE;
+	}
+	return indices;
+}
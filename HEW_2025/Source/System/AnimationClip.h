@@ -0,0 +1,64 @@
+/*****************************************************************//**
+ * @file   AnimationClip.h
+ * @brief  t@Cǂݍ񂾃Aj[ṼL[ifɈˑȂj
+ *
+ * AssetManager::GetAnimationClip ǂݍݍς݂̃pXƂɃLbV̂ŁA
+ * t@Cx Model::AddAnimation Ă assimp ł̓ǂݍ݂͍ŏ1񂾂łB
+ *
+ * `l̓m[hŎAǂ̃m[hԍɓ邩͍iƂ1񂾂
+ * NbvɊoĂ܂im[h̕т Model Ȃ獜i͓jB
+ *
+ * @author E
+ * @date   2025/11/28
+ *********************************************************************/
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "System/Model.h"
+
+class AnimationClip
+{
+public:
+	// 1m[h̃L[
+	struct Track
+	{
+		std::string		nodeName;	// Ήm[h
+		Model::Timeline	timeline;	// L[̕
+	};
+	using Tracks = std::vector<Track>;
+	using NodeIndices = std::vector<Model::NodeIndex>;
+
+	/**
+	 * @brief t@Cǂݍ
+	 * @param[in] file Aj[Vt@Cւ̃pX
+	 * @param[out] pError sR(svȂ nullptr)
+	 */
+	bool Load(const char* file, std::string* pError = nullptr);
+
+	const std::string& GetSource() const { return m_source; }
+	float GetTotalTime() const { return m_totalTime; }
+	const Tracks& GetTracks() const { return m_tracks; }
+
+	/// gbN i  skeleton ̂ǂ̃m[hɓ邩( INDEX_NONE)BiƂ1񂾂vZ
+	const NodeIndices& GetNodeIndices(const Model& skeleton) const;
+
+private:
+	// 1̍iɑ΂銄蓖
+	struct Binding
+	{
+		std::vector<std::string>	nodeNames;	// ĩm[h̕(nbVՓ˂Ƃ̏ƍp)
+		NodeIndices					indices;	// gbNƂ̃m[hԍ
+	};
+
+	std::string	m_source;			// ǂݍ݌̃t@C
+	float		m_totalTime = 0.0f;	// őĐ
+	Tracks		m_tracks;
+
+	// iƂ̃m[hԍBL[̓m[h̕т̃nbVŁAnbV̒ nodeNames Ō
+	mutable std::mutex	m_mtxBind;
+	mutable std::unordered_multimap<uint64_t, Binding>	m_bindings;
+};
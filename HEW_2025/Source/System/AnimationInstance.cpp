@@ -0,0 +1,556 @@
+/*****************************************************************//**
+ * @file   AnimationInstance.cpp
+ * @brief  GeBeBƂ̃Aj[VĐԂ̎
+ *
+ * @author E
+ * @date   2025/11/27
+ *********************************************************************/
+#include "AnimationInstance.h"
+#include <algorithm>
+
+namespace
+{
+	using namespace DirectX;
+
+	inline XMVECTOR Load4(const float* p) { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(p)); }
+	inline void Store4(float* p, FXMVECTOR v) { XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(p), v); }
+
+	/// out = a + (b - a) * t 4vf
+	void LerpLanes(float* out, const float* a, const float* b, size_t n, FXMVECTOR t)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			Store4(out + i, XMVectorLerpV(Load4(a + i), Load4(b + i), t));
+		}
+	}
+
+	/// 4{̉](x, y, z, w ꂼ1WX^)𐳋K
+	inline void NormalizeQuaternion4(XMVECTOR q[4])
+	{
+		XMVECTOR lenSq = XMVectorMultiply(q[0], q[0]);
+		lenSq = XMVectorMultiplyAdd(q[1], q[1], lenSq);
+		lenSq = XMVectorMultiplyAdd(q[2], q[2], lenSq);
+		lenSq = XMVectorMultiplyAdd(q[3], q[3], lenSq);
+		const XMVECTOR inv = XMVectorReciprocalSqrt(lenSq);
+		for (int k = 0; k < 4; ++k) { q[k] = XMVectorMultiply(q[k], inv); }
+	}
+
+	/**
+	 * ]̕(slerp)4m[h
+	 * ςȂ b 𔽓]čŒZoHʂBقړ̃[
+	 * sin() ł̊ZsɂȂ̂Ő`(nlerp)ɂAŌɂ܂Ƃ߂ĐK
+	 */
+	void SlerpQuaternions(float* const out[4], const float* const a[4], const float* const b[4], size_t n, FXMVECTOR t)
+	{
+		const XMVECTOR one = XMVectorReplicate(1.0f);
+		const XMVECTOR minusOne = XMVectorReplicate(-1.0f);
+		const XMVECTOR nearlyParallel = XMVectorReplicate(0.9995f);
+		const XMVECTOR oneMinusT = XMVectorSubtract(one, t);
+		for (size_t i = 0; i < n; i += 4)
+		{
+			XMVECTOR qa[4], qb[4];
+			for (int k = 0; k < 4; ++k)
+			{
+				qa[k] = Load4(a[k] + i);
+				qb[k] = Load4(b[k] + i);
+			}
+			// L[Ԃ̕Ԃ͐`Ȃ̂ŁApx߂Oɒ1ɖ߂
+			NormalizeQuaternion4(qa);
+			NormalizeQuaternion4(qb);
+
+			XMVECTOR dot = XMVectorMultiply(qa[0], qb[0]);
+			for (int k = 1; k < 4; ++k) { dot = XMVectorMultiplyAdd(qa[k], qb[k], dot); }
+			const XMVECTOR sign = XMVectorSelect(one, minusOne, XMVectorLess(dot, XMVectorZero()));
+			dot = XMVectorMin(XMVectorMultiply(dot, sign), one);
+
+			// Ԃ̏d(قړȂ 1 - t, t)
+			const XMVECTOR theta = XMVectorACos(dot);
+			const XMVECTOR invSin = XMVectorReciprocal(XMVectorSin(theta));
+			const XMVECTOR useLerp = XMVectorGreater(dot, nearlyParallel);
+			const XMVECTOR w0 = XMVectorSelect(XMVectorMultiply(XMVectorSin(XMVectorMultiply(oneMinusT, theta)), invSin), oneMinusT, useLerp);
+			const XMVECTOR w1 = XMVectorMultiply(XMVectorSelect(XMVectorMultiply(XMVectorSin(XMVectorMultiply(t, theta)), invSin), t, useLerp), sign);
+
+			XMVECTOR q[4];
+			for (int k = 0; k < 4; ++k)
+			{
+				q[k] = XMVectorMultiplyAdd(qa[k], w0, XMVectorMultiply(qb[k], w1));
+			}
+			NormalizeQuaternion4(q);
+			for (int k = 0; k < 4; ++k) { Store4(out[k] + i, q[k]); }
+		}
+	}
+
+	/// ]̐K4m[h(L[Ԃ̕Ԃ͐`Ȃ̂ŁA1炸Ă)
+	void NormalizeQuaternions(float* const out[4], const float* const in[4], size_t n)
+	{
+		for (size_t i = 0; i < n; i += 4)
+		{
+			XMVECTOR q[4];
+			for (int k = 0; k < 4; ++k) { q[k] = Load4(in[k] + i); }
+			NormalizeQuaternion4(q);
+			for (int k = 0; k < 4; ++k) { Store4(out[k] + i, q[k]); }
+		}
+	}
+}
+
+/*
+* @brief Đ郂fݒ
+* @param[in] model L̃f(nullptr ŉ)
+*/
+void AnimationInstance::Bind(const Model* model)
+{
+	if (m_model == model) { return; }
+
+	m_model = model;
+	m_playbacks.clear();
+	m_playNo = Model::ANIME_NONE;
+	m_blendNo = Model::ANIME_NONE;
+	m_parametric[0] = m_parametric[1] = Model::ANIME_NONE;
+	m_blendTime = 0.0f;
+	m_blendTotalTime = 0.0f;
+	m_parametricBlend = 0.0f;
+
+	const size_t nodeNum = model ? model->m_nodes.size() : 0;
+
+	// Aj[VvZ̈ɁAm[h̏f[^쐬
+	for (int i = 0; i < MAX_TRANSFORM; ++i)
+	{
+		m_nodeTransform[i].Reset(nodeNum);
+	}
+	m_local.Reset(nodeNum);
+
+	// p͓ǂݍݎ̂̂Ŏn߂
+	m_pose.resize(nodeNum);
+	for (size_t i = 0; i < nodeNum; ++i)
+	{
+		m_pose[i] = model->m_nodes[i].mat;
+	}
+	if (model) { m_palette = model->m_bindPalette; }
+	else { m_palette.clear(); }
+
+	SyncAnimations();
+}
+
+/*
+* @brief Aj[V̍XV
+* @param[in] tick Aj[Voߎ
+*/
+void AnimationInstance::Step(float tick)
+{
+	// Aj[V̍ĐmF
+	if (!m_model || m_playNo == Model::ANIME_NONE) { return; }
+
+	//--- Aj[Vs̍XV
+	// pgbN
+	if (m_playNo == Model::PARAMETRIC_ANIME || m_blendNo == Model::PARAMETRIC_ANIME)
+	{
+		CalcAnime(PARAMETRIC0, m_parametric[0]);
+		CalcAnime(PARAMETRIC1, m_parametric[1]);
+	}
+	// CAj
+	if (m_playNo != Model::ANIME_NONE && m_playNo != Model::PARAMETRIC_ANIME)
+	{
+		CalcAnime(MAIN, m_playNo);
+	}
+	// uhAj
+	if (m_blendNo != Model::ANIME_NONE && m_blendNo != Model::PARAMETRIC_ANIME)
+	{
+		CalcAnime(BLEND, m_blendNo);
+	}
+
+	// Aj[VsɊÂčsXV
+	if (!m_pose.empty())
+	{
+		CalcBones();
+		m_model->MakePalette(m_pose.data(), m_palette);
+	}
+
+	//--- Aj[V̎ԍXV
+	// CAj
+	UpdateAnime(m_playNo, tick);
+
+	// uhAj
+	if (m_blendNo != Model::ANIME_NONE)
+	{
+		UpdateAnime(m_blendNo, tick);
+
+		if (m_blendTotalTime > 0.0f)
+		{
+			// oߎԂi߂iNvtj
+			m_blendTime += tick;
+			if (m_blendTime >= m_blendTotalTime)
+			{
+				// uhI  uhCɏi
+				m_blendTime = 0.0f;
+				m_blendTotalTime = 0.0f;
+				m_playNo = m_blendNo;
+				m_blendNo = Model::ANIME_NONE;
+			}
+		}
+	}
+
+	// pgbN
+	if (m_playNo == Model::PARAMETRIC_ANIME || m_blendNo == Model::PARAMETRIC_ANIME)
+	{
+		UpdateAnime(m_parametric[0], tick);
+		UpdateAnime(m_parametric[1], tick);
+	}
+}
+
+/*
+* @brief Aj[VĐ
+* @param[in] no ĐAj[Vԍ
+* @param[in] loop [vĐtO
+* @param[in] speed Đx
+*/
+void AnimationInstance::Play(AnimeNo no, bool loop, float speed)
+{
+	// Đ`FbN
+	if (!AnimeNoCheck(no)) { return; }
+	if (m_playNo == no) { return; }
+
+	// Aj[V`FbN
+	if (no != Model::PARAMETRIC_ANIME)
+	{
+		// ʏ̏
+		InitAnime(no);
+		m_playbacks[no].isLoop = loop;
+		m_playbacks[no].speed = speed;
+	}
+	else
+	{
+		// Aj[V̌ɂȂĂAj[V
+		InitAnime(m_parametric[0]);
+		InitAnime(m_parametric[1]);
+		m_playbacks[m_parametric[0]].isLoop = loop;
+		m_playbacks[m_parametric[1]].isLoop = loop;
+		SetParametricBlend(0.0f);
+	}
+
+	// ĐAj[V̐ݒ
+	m_playNo = no;
+}
+
+/*
+* @brief uhĐ
+* @param[in] no Aj[Vԍ
+* @param[in] blendTime uhɊ|鎞
+* @param[in] loop [vtO
+* @param[in] speed Đx
+*/
+void AnimationInstance::PlayBlend(AnimeNo no, float blendTime, bool loop, float speed)
+{
+	// Đ`FbN
+	if (!AnimeNoCheck(no)) { return; }
+
+	// Aj[V`FbN
+	if (no != Model::PARAMETRIC_ANIME)
+	{
+		InitAnime(no);
+		m_playbacks[no].isLoop = loop;
+		m_playbacks[no].speed = speed;
+	}
+	else
+	{
+		// Aj[V̌ɂȂĂAj[V
+		InitAnime(m_parametric[0]);
+		InitAnime(m_parametric[1]);
+		m_playbacks[m_parametric[0]].isLoop = loop;
+		m_playbacks[m_parametric[1]].isLoop = loop;
+		SetParametricBlend(0.0f);
+	}
+
+	// uh̐ݒ
+	m_blendTime = 0.0f;
+	m_blendTotalTime = blendTime;
+	m_blendNo = no;
+}
+
+/*
+* @brief Aj[V̐ݒ
+* @param[in] no1 Aj1
+* @param[in] no2 Aj2
+*/
+void AnimationInstance::SetParametric(AnimeNo no1, AnimeNo no2)
+{
+	// Aj[V`FbN
+	if (!AnimeNoCheck(no1)) { return; }
+	if (!AnimeNoCheck(no2)) { return; }
+
+	// ݒ
+	m_parametric[0] = no1;
+	m_parametric[1] = no2;
+	SetParametricBlend(0.0f);
+}
+
+/*
+* @brief Aj[V̍ݒ
+* @param[in] blendRate 
+*/
+void AnimationInstance::SetParametricBlend(float blendRate)
+{
+	// Ajݒ肳Ă邩mF
+	if (m_parametric[0] == Model::ANIME_NONE || m_parametric[1] == Model::ANIME_NONE) return;
+	SyncAnimations();
+
+	// ݒ
+	m_parametricBlend = blendRate;
+
+	// ɊÂăAj[V̍Đxݒ
+	const float totalTime1 = m_model->m_animes[m_parametric[0]].totalTime;
+	const float totalTime2 = m_model->m_animes[m_parametric[1]].totalTime;
+	float blendTotalTime = totalTime1 * (1.0f - m_parametricBlend) + totalTime2 * m_parametricBlend;
+	m_playbacks[m_parametric[0]].speed = totalTime1 / blendTotalTime;
+	m_playbacks[m_parametric[1]].speed = totalTime2 / blendTotalTime;
+}
+
+/*
+* @brief Aj[V̍ĐԂύX
+* @param[in] no ύXAj
+* @param[in] time VĐ
+*/
+void AnimationInstance::SetAnimationTime(AnimeNo no, float time)
+{
+	// Aj[V`FbN
+	if (!AnimeNoCheck(no) || no == Model::PARAMETRIC_ANIME) { return; }
+	SyncAnimations();
+
+	// ĐԕύX
+	const float totalTime = m_model->m_animes[no].totalTime;
+	Playback& playback = m_playbacks[no];
+	playback.nowTime = time;
+	while (playback.nowTime >= totalTime)
+	{
+		playback.nowTime -= totalTime;
+	}
+}
+
+void AnimationInstance::StopAnimation()
+{
+	// Đ̃AjׂăZbg
+	m_playNo = Model::ANIME_NONE;
+	m_blendNo = Model::ANIME_NONE;
+	m_blendTime = 0.0f;
+	m_blendTotalTime = 0.0f;
+}
+
+/*
+* @brief ĐtO̎擾
+* @param[in] no ׂAjԍ
+* @return ݍĐȂtrue
+*/
+bool AnimationInstance::IsPlay(AnimeNo no) const
+{
+	// Aj[V`FbN
+	if (!AnimeNoCheck(no)) { return false; }
+
+	// pgbÑ͍Ajɔf
+	if (no == Model::PARAMETRIC_ANIME) { no = m_parametric[0]; }
+	if (no >= static_cast<AnimeNo>(m_playbacks.size())) { return false; }
+
+	// ĐԂ̔
+	if (m_model->m_animes[no].totalTime < m_playbacks[no].nowTime) { return false; }
+
+	// ꂼ̍Đԍɐݒ肳Ă邩mF
+	if (m_playNo == no) { return true; }
+	if (m_blendNo == no) { return true; }
+	if (m_playNo == Model::PARAMETRIC_ANIME || m_blendNo == Model::PARAMETRIC_ANIME)
+	{
+		if (m_parametric[0] == no) { return true; }
+		if (m_parametric[1] == no) { return true; }
+	}
+
+	// ĐłȂ
+	return false;
+}
+
+/*
+* @brief Aj[V̕ϊs擾
+* @param[in] index {[ԍ
+* @return Y{[̕ϊs
+*/
+DirectX::XMMATRIX AnimationInstance::GetBone(NodeIndex index) const
+{
+	if (0 <= index && index < static_cast<NodeIndex>(m_pose.size()))
+	{
+		return m_pose[index];
+	}
+	return DirectX::XMMatrixIdentity();
+}
+
+
+bool AnimationInstance::AnimeNoCheck(AnimeNo no) const
+{
+	if (!m_model) { return false; }
+
+	// pgbNAj[VmF
+	if (no == Model::PARAMETRIC_ANIME)
+	{
+		// pgbÑAj[Vݒ肳Ă邩
+		return
+			m_parametric[0] != Model::ANIME_NONE &&
+			m_parametric[1] != Model::ANIME_NONE;
+	}
+	else
+	{
+		// ȂAj[Vԍǂ
+		return 0 <= no && no < static_cast<AnimeNo>(m_model->m_animes.size());
+	}
+}
+/*
+* @brief fɌォǉꂽAj[V̍ĐԂm
+*/
+void AnimationInstance::SyncAnimations()
+{
+	const size_t animeNum = m_model ? m_model->m_animes.size() : 0;
+	if (m_playbacks.size() == animeNum) { return; }
+
+	m_playbacks.resize(animeNum);
+	for (size_t i = 0; i < animeNum; ++i)
+	{
+		m_playbacks[i].cursors.resize(m_model->m_animes[i].channels.size(), 0);
+	}
+}
+void AnimationInstance::InitAnime(AnimeNo no)
+{
+	// Aj̐ݒȂApgbNŐݒ肳ĂȂ珉Ȃ
+	if (no == Model::ANIME_NONE || no == Model::PARAMETRIC_ANIME) { return; }
+
+	SyncAnimations();
+	Playback& playback = m_playbacks[no];
+	playback.nowTime = 0.0f;
+	playback.speed = 1.0f;
+	playback.isLoop = false;
+	std::fill(playback.cursors.begin(), playback.cursors.end(), 0);
+}
+void AnimationInstance::CalcAnime(AnimeTransform kind, AnimeNo no)
+{
+	const Model::Animation& anime = m_model->m_animes[no];
+	Playback& playback = m_playbacks[no];
+	for (size_t c = 0; c < anime.channels.size(); ++c)
+	{
+		// v{[Ȃ΃XLbv
+		const Model::Channel& channel = anime.channels[c];
+		if (channel.index == Model::INDEX_NONE || channel.pTimeline->empty())
+		{
+			continue;
+		}
+
+		//--- Ym[h̎pAj[VōXV
+		Model::Transform transform;
+		Model::SampleTimeline(*channel.pTimeline, playback.nowTime, &playback.cursors[c], &transform);
+		m_nodeTransform[kind].Set(channel.index, transform);
+	}
+}
+void AnimationInstance::UpdateAnime(AnimeNo no, float tick)
+{
+	if (no == Model::PARAMETRIC_ANIME) { return; }
+
+	const float totalTime = m_model->m_animes[no].totalTime;
+	Playback& playback = m_playbacks[no];
+	playback.nowTime += playback.speed * tick;
+	if (playback.isLoop)
+	{
+		while (playback.nowTime >= totalTime)
+		{
+			playback.nowTime -= totalTime;
+		}
+	}
+}
+void AnimationInstance::CalcBones()
+{
+	using E = LocalPose::Element;
+	const size_t lanes = m_local.Size();
+	auto quaternion = [](LocalPose& pose, float* out[4])
+		{
+			for (int k = 0; k < 4; ++k) { out[k] = pose.elements[E::QX + k].data(); }
+		};
+	// 2̎p rate ŕԂ out 
+	auto blend = [&](LocalPose& out, LocalPose& a, LocalPose& b, float rate)
+		{
+			const DirectX::XMVECTOR t = DirectX::XMVectorReplicate(rate);
+			for (E e : { E::TX, E::TY, E::TZ, E::SX, E::SY, E::SZ })
+			{
+				LerpLanes(out.elements[e].data(), a.elements[e].data(), b.elements[e].data(), lanes, t);
+			}
+			float* qo[4]; float* qa[4]; float* qb[4];
+			quaternion(out, qo); quaternion(a, qa); quaternion(b, qb);
+			SlerpQuaternions(qo, qa, qb, lanes, t);
+		};
+
+	//--- Aj[VƂ̃p[^
+	// pgbN
+	if (m_playNo == Model::PARAMETRIC_ANIME)
+	{
+		blend(m_nodeTransform[MAIN], m_nodeTransform[PARAMETRIC0], m_nodeTransform[PARAMETRIC1], m_parametricBlend);
+	}
+	if (m_blendNo == Model::PARAMETRIC_ANIME)
+	{
+		blend(m_nodeTransform[BLEND], m_nodeTransform[PARAMETRIC0], m_nodeTransform[PARAMETRIC1], m_parametricBlend);
+	}
+	// uhAj
+	if (m_blendNo != Model::ANIME_NONE && m_blendTotalTime > 0.0f)
+	{
+		float t = std::clamp(m_blendTime / m_blendTotalTime, 0.0f, 1.0f);
+		blend(m_local, m_nodeTransform[MAIN], m_nodeTransform[BLEND], t);
+	}
+	else
+	{
+		// CAĵ
+		for (E e : { E::TX, E::TY, E::TZ, E::SX, E::SY, E::SZ })
+		{
+			m_local.elements[e] = m_nodeTransform[MAIN].elements[e];
+		}
+		float* qo[4]; float* qi[4];
+		quaternion(m_local, qo); quaternion(m_nodeTransform[MAIN], qi);
+		NormalizeQuaternions(qo, qi, lanes);
+	}
+
+	//--- e珇ɎpsvZ(e͕KqOɂ)
+	const float scale = m_model->m_loadScale;
+	const DirectX::XMMATRIX root = DirectX::XMMatrixScaling(scale, scale, scale);
+	const std::vector<NodeIndex>& parents = m_model->m_nodeParents;
+	const float* el[LocalPose::ELEMENT_NUM];
+	for (int k = 0; k < LocalPose::ELEMENT_NUM; ++k) { el[k] = m_local.elements[k].data(); }
+	for (size_t i = 0; i < m_pose.size(); ++i)
+	{
+		const DirectX::XMVECTOR S = DirectX::XMVectorSet(el[E::SX][i], el[E::SY][i], el[E::SZ][i], 0.0f);
+		const DirectX::XMVECTOR R = DirectX::XMVectorSet(el[E::QX][i], el[E::QY][i], el[E::QZ][i], el[E::QW][i]);
+		const DirectX::XMVECTOR T = DirectX::XMVectorSet(el[E::TX][i], el[E::TY][i], el[E::TZ][i], 0.0f);
+		const DirectX::XMMATRIX local = DirectX::XMMatrixAffineTransformation(S, DirectX::XMVectorZero(), R, T);
+
+		const NodeIndex parent = parents[i];
+		m_pose[i] = local * (parent == Model::INDEX_NONE ? root : m_pose[parent]);
+	}
+}
+
+/*
+* @brief m[h̒Pʕϊ쐬
+* @param[in] nodeNum m[h
+*/
+void AnimationInstance::LocalPose::Reset(size_t nodeNum)
+{
+	const size_t lanes = (nodeNum + 3) & ~static_cast<size_t>(3);
+	for (int e = 0; e < ELEMENT_NUM; ++e)
+	{
+		const bool one = (e == QW || e == SX || e == SY || e == SZ);
+		elements[e].assign(lanes, one ? 1.0f : 0.0f);
+	}
+}
+
+/*
+* @brief 1m[h̕ϊݒ
+*/
+void AnimationInstance::LocalPose::Set(size_t index, const Model::Transform& transform)
+{
+	elements[TX][index] = transform.translate.x;
+	elements[TY][index] = transform.translate.y;
+	elements[TZ][index] = transform.translate.z;
+	elements[QX][index] = transform.quaternion.x;
+	elements[QY][index] = transform.quaternion.y;
+	elements[QZ][index] = transform.quaternion.z;
+	elements[QW][index] = transform.quaternion.w;
+	elements[SX][index] = transform.scale.x;
+	elements[SY][index] = transform.scale.y;
+	elements[SZ][index] = transform.scale.z;
+}
@@ -0,0 +1,124 @@
+/*****************************************************************//**
+ * @file   AnimationInstance.h
+ * @brief  L Model ɑ΂AGeBeBƂ̃Aj[VĐ
+ *
+ * ModelibVE}eAEiEAj[Vj AssetManager::GetModel 
+ * LAĐ̃AjԍEĐԁEuhԁE̎p
+ * GeBeBƂɂŎ܂iModelAnimationComponent ɓĂjB
+ * LN^[𑝂₵Ăf̓ǂݒ͋N܂B
+ *
+ * g:
+ *  - Bind(model) őΏۂ̃f߂iʂ̃fɕςƏԂ͍蒼j
+ *  - Play / PlayBlend Ȃǂ͏] Model ̓֐Ɠ
+ *  - Step(dt) ŎԂi߂ĎpvZAModel::Draw ɓnĕ`悷
+ *
+ * p̌vZ:
+ *  - m[hƂ̕ϊ(ʒuE]Egk)͗vfƂ̔z(SoA)ŎA
+ *    uhE4m[h SIMD ŕԂ(]͍ŒZoH slerp)
+ *  - e͕KqOɕł(Model ̓ǂݍݏ)̂ŁAs͑O1Ȃ߂邾ŋ܂
+ *
+ * @author E
+ * @date   2025/11/27
+ *********************************************************************/
+#pragma once
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+#include "System/Model.h"
+
+class AnimationInstance
+{
+public:
+	using AnimeNo = Model::AnimeNo;
+	using NodeIndex = Model::NodeIndex;
+
+	/// Đ郂fݒ肷ifȂ牽Ȃj
+	void Bind(const Model* model);
+	bool IsBoundTo(const Model* model) const { return m_model != nullptr && m_model == model; }
+	const Model* GetModel() const { return m_model; }
+
+	// Aj[V̍XV
+	void Step(float tick);
+
+	// Aj[V̍Đ
+	void Play(AnimeNo no, bool loop, float speed = 1.0f);
+	// Aj[ṼuhĐ
+	void PlayBlend(AnimeNo no, float blendTime, bool loop, float speed = 1.0f);
+	// Aj[V̍ݒ
+	void SetParametric(AnimeNo no1, AnimeNo no2);
+	// Aj[V̍ݒ
+	void SetParametricBlend(float blendRate);
+	// Aj[V̌ݍĐԂύX
+	void SetAnimationTime(AnimeNo no, float time);
+	// Aj[V~
+	void StopAnimation();
+
+	// ĐtO
+	bool IsPlay(AnimeNo no) const;
+	// ݍĐ̃Ajԍ
+	AnimeNo GetPlayNo() const { return m_playNo; }
+	// uh̃Ajԍ
+	AnimeNo GetBlendNo() const { return m_blendNo; }
+
+	/// Aj[V̕ϊs擾
+	DirectX::XMMATRIX GetBone(NodeIndex index) const;
+	/// SbṼXLjOs(Step ŎpƈꏏɍXVBт Model ߂)
+	const std::vector<DirectX::XMFLOAT4X4>& GetPalette() const { return m_palette; }
+
+private:
+	// Aj[VvZ̈
+	enum AnimeTransform
+	{
+		MAIN,			// ʏĐ
+		BLEND,			// uhĐ
+		PARAMETRIC0,	// A
+		PARAMETRIC1,	// B
+		MAX_TRANSFORM
+	};
+
+	// Aj[VƂ̍Đ
+	struct Playback
+	{
+		float	nowTime = 0.0f;	// ݂̍Đ
+		float	speed = 1.0f;	// Đx
+		bool	isLoop = false;	// [vw
+		std::vector<uint32_t> cursors;	// `lƂ̍Đʒu(nowTime ރL[̑O)
+	};
+
+	// m[hƂ̕ϊvfƂ̔zŎ(4̔{B]͒PʕϊŖ߂)
+	struct LocalPose
+	{
+		enum Element { TX, TY, TZ, QX, QY, QZ, QW, SX, SY, SZ, ELEMENT_NUM };
+		std::vector<float>	elements[ELEMENT_NUM];
+
+		void Reset(size_t nodeNum);
+		void Set(size_t index, const Model::Transform& transform);
+		size_t Size() const { return elements[TX].size(); }
+	};
+
+	// vZ
+	bool AnimeNoCheck(AnimeNo no) const;
+	void SyncAnimations();
+	void InitAnime(AnimeNo no);
+	void CalcAnime(AnimeTransform kind, AnimeNo no);
+	void UpdateAnime(AnimeNo no, float tick);
+	void CalcBones();
+
+private:
+	const Model*	m_model = nullptr;	// Đ郂f(LBL͂Ȃ)
+
+	std::vector<Playback>	m_playbacks;	// AjԍƂ̍Đ
+
+	AnimeNo			m_playNo = Model::ANIME_NONE;		// ݍĐ̃Ajԍ
+	AnimeNo			m_blendNo = Model::ANIME_NONE;		// uhĐsAjԍ
+	AnimeNo			m_parametric[2] = { Model::ANIME_NONE, Model::ANIME_NONE };	// ĐsAjԍ
+	float			m_blendTime = 0.0f;			// ݂̑Jڌoߎ
+	float			m_blendTotalTime = 0.0f;	// AjJڂɂ鍇v
+	float			m_parametricBlend = 0.0f;	// pgbN̍Đ
+
+	LocalPose		m_nodeTransform[MAX_TRANSFORM];	// Aj[Vʕό`
+	LocalPose		m_local;						// ̕ό`
+	std::vector<DirectX::XMMATRIX>	m_pose;			// m[hƂ̎ps
+	std::vector<DirectX::XMFLOAT4X4>	m_palette;	// XLjOs(`悲Ƃɍ蒼Ȃ)
+};
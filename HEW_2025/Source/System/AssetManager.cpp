@@ -4,6 +4,7 @@
  *
  * - AssetCatalog pXEXP[
  * - Model / Texture  shared_ptr LbV
+ * - AnimationClip ͉͌ʂpXƂɕێisoj
  * - Audio / Effect ̓pX܂ޏ\̂Ԃ
  *
  * @author  E
@@ -12,6 +13,7 @@
 #include "AssetManager.h"
 #include "AssetCatalog.h"
 #include "Model.h"
+#include "AnimationClip.h"
 #include "DirectX/Texture.h"
 
 #include <cassert>
@@ -26,6 +28,10 @@ std::mutex                                               AssetManager::s_mtxTex;
 std::unordered_map<std::string, std::shared_ptr<AudioClip>> AssetManager::s_audioCache;
 std::mutex                                                   AssetManager::s_mtxAudio;
 
+// ==== AnimationClip LbV ====
+std::unordered_map<std::string, std::shared_ptr<AnimationClip>> AssetManager::s_clipCache;
+std::mutex                                                       AssetManager::s_mtxClip;
+
 void AssetManager::Init()
 {
     // Ȃ
@@ -36,9 +42,11 @@ void AssetManager::Shutdown()
 {
     std::lock_guard<std::mutex> lk1(s_mtxModel);
     std::lock_guard<std::mutex> lk2(s_mtxTex);
+    std::lock_guard<std::mutex> lk3(s_mtxClip);
 
     s_modelCache.clear();
     s_texCache.clear();
+    s_clipCache.clear();
 }
 
 AssetManager::Resolved AssetManager::ResolveModel(const std::string& aliasOrPath)
@@ -155,6 +163,35 @@ AssetHandle<Model> AssetManager::CreateModelInstance(const std::string& aliasOrP
     return AssetHandle<Model>(sp);
 }
 
+AssetHandle<AnimationClip> AssetManager::GetAnimationClip(const std::string& aliasOrPath)
+{
+    // 1. pX
+    const std::string path = ResolveAnimationPath(aliasOrPath);
+
+    // 2. LbVmFispX nullptr œĂj
+    {
+        std::lock_guard<std::mutex> lock(s_mtxClip);
+
+        auto it = s_clipCache.find(path);
+        if (it != s_clipCache.end())
+        {
+            return AssetHandle<AnimationClip>(it->second);
+        }
+    }
+
+    // 3. [h
+    auto sp = LoadAnimationClipByPath(path);
+
+    // 4. LbVo^iXbhɓo^Ă΂gj
+    {
+        std::lock_guard<std::mutex> lock(s_mtxClip);
+        auto it = s_clipCache.emplace(path, sp).first;
+        sp = it->second;
+    }
+
+    return AssetHandle<AnimationClip>(sp);
+}
+
 AssetHandle<Texture> AssetManager::GetTexture(const std::string& aliasOrPath)
 {
     // 1. pX
@@ -299,6 +336,23 @@ std::shared_ptr<Texture> AssetManager::LoadTextureByPath(const std::string& path
     return tex;
 }
 
+std::shared_ptr<AnimationClip> AssetManager::LoadAnimationClipByPath(const std::string& path)
+{
+    auto clip = std::make_shared<AnimationClip>();
+
+    std::string error;
+    if (!clip->Load(path.c_str(), &error))
+    {
+#if defined(_DEBUG)
+        std::string msg = "[AssetManager::GetAnimationClip] failed to load '" + path + "': " + error + "\n";
+        OutputDebugStringA(msg.c_str());
+#endif
+        return nullptr;
+    }
+
+    return clip;
+}
+
 void AssetManager::UpdateHotReload(float /*dt*/)
 {
     // TODO:
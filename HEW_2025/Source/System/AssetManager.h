@@ -4,6 +4,7 @@
  *
  * - AssetCatalogiCSV 䒠jpXEXP[
  * - 3D fƃeNX` shared_ptr LbV
+ * - Aj[V͉͍ς݂̃L[iAnimationClipjpXƂɕێAǂݒȂ
  * - Audio / Effect ́upX̌yʍ\́vƂĕԂ
  * - XbhZ[t̂߁ALbVɂ mutex gp
  *
@@ -20,6 +21,7 @@
 
 class Model;
 class Texture;
+class AnimationClip;
 struct AssetDesc;
 
 /**
@@ -137,9 +139,14 @@ public:
     static AssetHandle<Model> GetModel(const std::string& aliasOrPath);
 
     /// 񋤗Lf擾iVKɓǂݍ݁AƗCX^XԂj
-    /// - Aj[VԂGeBeBƂɓƗꍇɎgp
+    /// - Aj[VԂ AnimationInstance GeBeBƂɎ̂ŁAAĵ߂ɂ͕sv
+    /// - bV}eÂꍇɎgp
     static AssetHandle<Model> CreateModelInstance(const std::string& aliasOrPath);
 
+    /// Aj[VNbv擾iResolveAnimationPath ̃pX Shutdown ܂ŕێj
+    /// - ǂݍ݂ɎspXoĂAĎs I/O Ȃ
+    static AssetHandle<AnimationClip> GetAnimationClip(const std::string& aliasOrPath);
+
     /// eNX`擾iLbVj
     static AssetHandle<Texture> GetTexture(const std::string& aliasOrPath);
 
@@ -152,13 +159,16 @@ public:
 private:
     static std::shared_ptr<Model>   LoadModelByPath(const std::string& path, float scale, int flip);
     static std::shared_ptr<Texture> LoadTextureByPath(const std::string& path);
+    static std::shared_ptr<AnimationClip> LoadAnimationClipByPath(const std::string& path);
 
 private:
     static std::unordered_map<std::string, std::weak_ptr<Model>>   s_modelCache;
     static std::unordered_map<std::string, std::weak_ptr<Texture>> s_texCache;
     static std::unordered_map<std::string, std::shared_ptr<AudioClip>> s_audioCache;
+    static std::unordered_map<std::string, std::shared_ptr<AnimationClip>> s_clipCache;
     static std::mutex                                               s_mtxModel;
     static std::mutex                                               s_mtxTex;
     static std::mutex                                               s_mtxAudio;
+    static std::mutex                                               s_mtxClip;
 
 };
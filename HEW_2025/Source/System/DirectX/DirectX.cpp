@@ -1,9 +1,11 @@
 #include "DirectX.h"
 #include "Texture.h"
+#include <d3d11_1.h>
 
 //--- O[oϐ
 ID3D11Device*				g_pDevice;
 ID3D11DeviceContext*		g_pContext;
+ID3D11DeviceContext1*		g_pContext1;
 IDXGISwapChain*				g_pSwapChain;
 RenderTarget*				g_pRTV;
 DepthStencil*				g_pDSV;
@@ -21,6 +23,10 @@ ID3D11DeviceContext* GetContext()
 {
 	return g_pContext;
 }
+ID3D11DeviceContext1* GetContext1()
+{
+	return g_pContext1;
+}
 IDXGISwapChain* GetSwapChain()
 {
 	return g_pSwapChain;
@@ -103,6 +109,14 @@ HRESULT InitDirectX(HWND hWnd, UINT width, UINT height, bool fullscreen)
 		return hr;
 	}
 
+	//--- 萔obt@̕XVg邩(gȂ Shader::WriteBuffer ͑Ŝ𑗂)
+	D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+	if (SUCCEEDED(g_pDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options)))
+		&& options.ConstantBufferPartialUpdate)
+	{
+		g_pContext->QueryInterface(IID_PPV_ARGS(&g_pContext1));
+	}
+
 	//--- _[^[Qbgݒ
 	g_pRTV = new RenderTarget();
 	if (FAILED(hr = g_pRTV->CreateFromScreen()))
@@ -217,6 +231,7 @@ void UninitDirectX()
 		SAFE_RELEASE(g_pRasterizerState[i]);
 	if(g_pContext)
 		g_pContext->ClearState();
+	SAFE_RELEASE(g_pContext1);
 	SAFE_RELEASE(g_pContext);
 	if(g_pSwapChain)
 		g_pSwapChain->SetFullscreenState(false, NULL);
@@ -11,6 +11,7 @@
 
 class RenderTarget;
 class DepthStencil;
+struct ID3D11DeviceContext1;
 
 enum BlendMode
 {
@@ -32,6 +33,8 @@ enum SamplerState
 
 ID3D11Device* GetDevice();
 ID3D11DeviceContext* GetContext();
+// 萔obt@̕XV(D3D11.1)gȂł nullptr
+ID3D11DeviceContext1* GetContext1();
 IDXGISwapChain* GetSwapChain();
 RenderTarget* GetDefaultRTV();
 DepthStencil* GetDefaultDSV();
@@ -1,6 +1,8 @@
 #include "Shader.h"
+#include <d3d11_1.h>
 #include <d3dcompiler.h>
 #include <stdio.h>
+#include <string.h>
 
 #pragma comment(lib, "d3dcompiler.lib")
 
@@ -71,8 +73,35 @@ HRESULT Shader::Compile(const char *pCode)
 
 void Shader::WriteBuffer(UINT slot, void* pData)
 {
-	if(slot < m_pBuffers.size())
-		GetContext()->UpdateSubresource(m_pBuffers[slot], 0, nullptr, pData, 0, 0);
+	if (slot >= m_pBuffers.size()) { return; }
+	GetContext()->UpdateSubresource(m_pBuffers[slot], 0, nullptr, pData, 0, 0);
+
+	// ʂgĂȂ獇킹Ă
+	if (!m_bufferCopies[slot].empty())
+	{
+		memcpy(m_bufferCopies[slot].data(), pData, m_bufferSizes[slot]);
+	}
+}
+void Shader::WriteBuffer(UINT slot, const void* pData, UINT byteOffset, UINT byteSize)
+{
+	if (slot >= m_pBuffers.size() || byteOffset >= m_bufferSizes[slot]) { return; }
+	if (byteSize > m_bufferSizes[slot] - byteOffset) { byteSize = m_bufferSizes[slot] - byteOffset; }
+	if (byteSize == 0) { return; }
+
+	// D3D11.1 Ȃ珑͈͂(͈͂16oCgP)
+	ID3D11DeviceContext1* pContext1 = GetContext1();
+	if (pContext1 && byteOffset % 16 == 0 && byteSize % 16 == 0)
+	{
+		D3D11_BOX box = { byteOffset, 0, 0, byteOffset + byteSize, 1, 1 };
+		pContext1->UpdateSubresource1(m_pBuffers[slot], 0, &box, pData, 0, 0, 0);
+		return;
+	}
+
+	// gȂΎʂ̊Y͈͂āAŜ𑗂
+	std::vector<unsigned char>& copy = m_bufferCopies[slot];
+	if (copy.empty()) { copy.resize(m_bufferSizes[slot], 0); }
+	memcpy(copy.data() + byteOffset, pData, byteSize);
+	GetContext()->UpdateSubresource(m_pBuffers[slot], 0, nullptr, copy.data(), 0, 0);
 }
 void Shader::SetTexture(UINT slot, Texture* tex)
 {
@@ -123,6 +152,8 @@ HRESULT Shader::Make(void* pData, UINT size)
 	D3D11_SHADER_DESC shaderDesc;
 	pReflection->GetDesc(&shaderDesc);
 	m_pBuffers.resize(shaderDesc.ConstantBuffers, nullptr);
+	m_bufferSizes.resize(shaderDesc.ConstantBuffers, 0);
+	m_bufferCopies.resize(shaderDesc.ConstantBuffers);
 	for (UINT i = 0; i < shaderDesc.ConstantBuffers; ++i)
 	{
 		// VF[_[̒萔obt@̏擾
@@ -133,6 +164,7 @@ HRESULT Shader::Make(void* pData, UINT size)
 		// 쐬obt@̏
 		D3D11_BUFFER_DESC bufDesc = {};
 		bufDesc.ByteWidth = shaderBufDesc.Size;
+		m_bufferSizes[i] = shaderBufDesc.Size;
 		bufDesc.Usage = D3D11_USAGE_DEFAULT;
 		bufDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 
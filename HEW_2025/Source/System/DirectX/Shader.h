@@ -36,6 +36,8 @@ public:
 
 	// 萔̏
 	void WriteBuffer(UINT slot, void* pData);
+	// 萔̈ꕔ(byteOffset  byteSize BȊO͑O̒l̂܂)
+	void WriteBuffer(UINT slot, const void* pData, UINT byteOffset, UINT byteSize);
 	// eNX`̐ݒ
 	void SetTexture(UINT slot, Texture* tex);
 	// VF[_[`Ɏgp
@@ -51,6 +53,8 @@ private:
 	Kind m_kind;
 protected:
 	std::vector<ID3D11Buffer*> m_pBuffers;
+	std::vector<UINT> m_bufferSizes;
+	std::vector<std::vector<unsigned char>> m_bufferCopies;	// XVgȂł̒萔̎ʂ
 	std::vector<ID3D11ShaderResourceView*> m_pTextures;
 };
 
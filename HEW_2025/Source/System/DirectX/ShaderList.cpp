@@ -90,6 +90,10 @@ void ShaderList::SetBones(DirectX::XMFLOAT4X4* bones200)
 {
 	m_pVS[VS_ANIME]->WriteBuffer(1, bones200);
 }
+void ShaderList::SetBones(const DirectX::XMFLOAT4X4* bones, UINT count)
+{
+	m_pVS[VS_ANIME]->WriteBuffer(1, bones, 0, count * static_cast<UINT>(sizeof(DirectX::XMFLOAT4X4)));
+}
 void ShaderList::SetMaterial(const Model::Material& material)
 {
 	DirectX::XMFLOAT4 param[3] = {
@@ -42,6 +42,8 @@ public:
 	// 萔obt@ւ̐ݒ
 	static void SetWVP(DirectX::XMFLOAT4X4* wvp);
 	static void SetBones(DirectX::XMFLOAT4X4* bones200);
+	// 擪 count {(c͑O̒l̂܂܁BbVQƂ鍜)
+	static void SetBones(const DirectX::XMFLOAT4X4* bones, UINT count);
 	static void SetMaterial(const Model::Material& material);
 	static void SetLight(DirectX::XMFLOAT4 color, DirectX::XMFLOAT3 dir);
 	static void SetCameraPos(const DirectX::XMFLOAT3 pos);
@@ -37,6 +37,9 @@ namespace EffectRuntime
     /// Effekseer::Handle BOł int ƂĈĂ悢B
     using Handle = std::int32_t;
 
+    /// SystemAccess::Resource<EffectRuntime::AccessTag>() Ń^C̐L錾邽߂̖ڈ
+    struct AccessTag {};
+
     /**
      * @brief Effekseer ^C
      * @return  true
@@ -28,6 +28,12 @@
 #include "ECS/Components/Physics/Collider2DComponent.h"
 #include "ECS/Components/Render/ModelComponent.h"
 #include "ECS/Tag/Tag.h"
+#include "ECS/Systems/SystemProfiler.h"
+#include "ECS/Systems/Update/Physics/AabbBatch2D.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <vector>
 
 // ImGui LIvV
 #ifdef IMGUI_ENABLED
@@ -183,6 +189,134 @@ namespace ImGuiLayer
 #endif
     }
 
+    // --- System Profiler \wp ---
+    static void DrawSystemProfiler()
+    {
+#if defined(IMGUI_ENABLED) && defined(IMGUI_HAS_CORE) && defined(IMGUI_HAS_WIN32) && defined(IMGUI_HAS_DX11)
+        auto& prof = SystemProfiler::Get();
+
+        bool enabled = prof.IsEnabled();
+        if (ImGui::Checkbox("Enabled", &enabled)) prof.SetEnabled(enabled);
+        ImGui::SameLine();
+        if (ImGui::Button("Reset")) prof.Reset();
+        ImGui::SameLine();
+        if (ImGui::Button("Dump CSV"))  prof.DumpCsv("system_profile.csv");
+        ImGui::SameLine();
+        if (ImGui::Button("Dump JSON")) prof.DumpJson("system_profile.json");
+
+        // ߕς̍~ŕׂ
+        std::vector<const SystemProfiler::Stats*> rows;
+        for (const auto& s : prof.GetAll())
+        {
+            if (s->samples > 0) rows.push_back(s.get());
+        }
+        std::sort(rows.begin(), rows.end(),
+            [](const SystemProfiler::Stats* a, const SystemProfiler::Stats* b) { return a->avgMs > b->avgMs; });
+
+        static std::string selected;
+
+        ImGui::Columns(5, "SystemProfilerColumns");
+        ImGui::Text("System"); ImGui::NextColumn();
+        ImGui::Text("Phase");  ImGui::NextColumn();
+        ImGui::Text("Avg ms"); ImGui::NextColumn();
+        ImGui::Text("Max ms"); ImGui::NextColumn();
+        ImGui::Text("Peak ms"); ImGui::NextColumn();
+        ImGui::Separator();
+        for (const auto* s : rows)
+        {
+            if (ImGui::Selectable(s->name.c_str(), selected == s->name, ImGuiSelectableFlags_SpanAllColumns)) selected = s->name;
+            ImGui::NextColumn();
+            ImGui::Text("%s", SystemProfiler::PhaseName(s->phase)); ImGui::NextColumn();
+            ImGui::Text("%.3f", s->avgMs);  ImGui::NextColumn();
+            ImGui::Text("%.3f", s->maxMs);  ImGui::NextColumn();
+            ImGui::Text("%.3f", s->peakMs); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+
+        // I System ̃qXgOir: 0.01ms ... 16ms, Ō͒߁j
+        for (const auto* s : rows)
+        {
+            if (s->name != selected) continue;
+            float bins[SystemProfiler::kHistogramBins];
+            for (std::size_t b = 0; b < SystemProfiler::kHistogramBins; ++b) bins[b] = static_cast<float>(s->histogram[b]);
+            ImGui::PlotHistogram("##hist", bins, static_cast<int>(SystemProfiler::kHistogramBins), 0, s->name.c_str(), 0.0f, FLT_MAX, ImVec2(0, 80));
+            ImGui::TextDisabled("bins: <=0.01 / 0.025 / 0.05 / 0.1 / 0.25 / 0.5 / 1 / 2 / 4 / 8 / 16 / >16 ms");
+        }
+#endif
+    }
+
+    // --- AABB ꊇJ[l̃x`}[N ---
+    static void DrawCollisionKernelBenchmark()
+    {
+#if defined(IMGUI_ENABLED) && defined(IMGUI_HAS_CORE) && defined(IMGUI_HAS_WIN32) && defined(IMGUI_HAS_DX11)
+        static int boxCount = 4096;
+        static int queryCount = 256;
+        static AabbBatch2D::BenchmarkResult result;
+        static bool hasResult = false;
+
+        ImGui::Text("SIMD: %s", AabbBatch2D::SimdName());
+        ImGui::SliderInt("Boxes", &boxCount, 64, 65536);
+        ImGui::SliderInt("Queries", &queryCount, 1, 4096);
+        if (ImGui::Button("Run AABB Benchmark"))
+        {
+            result = AabbBatch2D::RunBenchmark(static_cast<std::size_t>(boxCount), static_cast<std::size_t>(queryCount));
+            hasResult = true;
+        }
+
+        if (hasResult)
+        {
+            ImGui::Text("pair (Transform + Collider) : %.3f ms", result.pairScalarMs);
+            ImGui::Text("SoA scalar                  : %.3f ms", result.batchScalarMs);
+            ImGui::Text("SoA %-6s                  : %.3f ms", AabbBatch2D::SimdName(), result.batchSimdMs);
+            ImGui::Text("hits %zu (%s)", result.hitCount, result.hitsMatch ? "match" : "MISMATCH");
+        }
+#endif
+    }
+
+    // --- Aj[ṼL[Ԃ̃x`}[Nĩ݂V[̃vC[fŌvj ---
+    static void DrawAnimationSamplingBenchmark()
+    {
+#if defined(IMGUI_ENABLED) && defined(IMGUI_HAS_CORE) && defined(IMGUI_HAS_WIN32) && defined(IMGUI_HAS_DX11)
+        static int frames = 600;
+        static Model::SampleBenchmarkResult result;
+        static bool hasResult = false;
+
+        ImGui::SliderInt("Frames", &frames, 60, 60000);
+        if (ImGui::Button("Run Sampling Benchmark"))
+        {
+            SceneManager& sm = GetSceneManager();
+            World* world = nullptr;
+            if (auto* game = dynamic_cast<GameScene*>(sm.Current())) world = &game->GetWorld();
+            else if (auto* test = dynamic_cast<TestStageScene*>(sm.Current())) world = &test->GetWorld();
+
+            // Aj[Vŏ̃vC[̃fŌv
+            hasResult = false;
+            if (world)
+            {
+                world->View<const TagPlayer, const ModelRendererComponent>(
+                    [&](EntityId, const TagPlayer&, const ModelRendererComponent& mr)
+                    {
+                        if (hasResult || !mr.model || !mr.model->GetAnimation(0)) return;
+                        result = mr.model->RunSampleBenchmark(frames);
+                        hasResult = true;
+                    });
+            }
+        }
+
+        if (hasResult)
+        {
+            ImGui::Text("clips %zu / channels %zu / samples %zu", result.clipCount, result.channelCount, result.sampleCount);
+            ImGui::Text("std::map + upper_bound : %.3f ms", result.mapMs);
+            ImGui::Text("flat keys + cursor     : %.3f ms", result.flatMs);
+            ImGui::Text("%s", result.match ? "match" : "MISMATCH");
+        }
+        else
+        {
+            ImGui::TextDisabled("Needs a scene with an animated player");
+        }
+#endif
+    }
+
     void BeginFrame()
     {
 #if defined(IMGUI_ENABLED) && defined(IMGUI_HAS_CORE) && defined(IMGUI_HAS_WIN32) && defined(IMGUI_HAS_DX11)
@@ -283,6 +417,27 @@ namespace ImGuiLayer
                 else if (ta.GetState() == TimeAttackManager::State::Running) { ta.NotifyDeath(); }
             }
 
+            // =====================
+            // System Profiler Header
+            // =====================
+            if (ImGui::CollapsingHeader("System Profiler"))
+            {
+                DrawSystemProfiler();
+            }
+
+            // =====================
+            // Benchmark Headers
+            // =====================
+            if (ImGui::CollapsingHeader("Collision Kernel"))
+            {
+                DrawCollisionKernelBenchmark();
+            }
+
+            if (ImGui::CollapsingHeader("Animation Sampling"))
+            {
+                DrawAnimationSamplingBenchmark();
+            }
+
             // =====================
             // Entity Header (VK)
             // =====================
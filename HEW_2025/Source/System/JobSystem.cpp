@@ -0,0 +1,217 @@
+/*****************************************************************//**
+ * @file   JobSystem.cpp
+ * @brief  [NXeB[ÕWuv[
+ *
+ * @author E
+ * @date   2025/11/11
+ *********************************************************************/
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /// ParallelFor 1`N
+    struct Job
+    {
+        JobSystem::RangeFn fn = nullptr;
+        void* ctx = nullptr;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::atomic<std::size_t>* remaining = nullptr; ///< s̎c`N
+    };
+
+    /// XbhƂ̃L[i: 傪 / O: Xbhށj
+    struct WorkQueue
+    {
+        std::mutex        mtx;
+        std::deque<Job>   jobs;
+    };
+
+    // L[[0] ̓CXbhiу[J[ȊǑĂяojpA[1..] [J[p
+    std::vector<std::unique_ptr<WorkQueue>> g_queues;
+    std::vector<std::thread>                g_threads;
+
+    std::mutex              g_sleepMtx;
+    std::condition_variable g_sleepCv;
+    std::atomic<std::size_t> g_queued{ 0 };  ///< SL[ɐς܂Ă関Wu
+    std::atomic<bool>        g_running{ false };
+
+    /// ݃Xbh̃L[ԍ
+    thread_local std::size_t t_queueIndex = 0;
+
+    bool PopLocal(std::size_t index, Job& out)
+    {
+        WorkQueue& q = *g_queues[index];
+        std::lock_guard<std::mutex> lk(q.mtx);
+        if (q.jobs.empty())
+        {
+            return false;
+        }
+        out = q.jobs.back();
+        q.jobs.pop_back();
+        return true;
+    }
+
+    bool Steal(std::size_t index, Job& out)
+    {
+        const std::size_t n = g_queues.size();
+        for (std::size_t k = 1; k < n; ++k)
+        {
+            WorkQueue& q = *g_queues[(index + k) % n];
+            std::lock_guard<std::mutex> lk(q.mtx);
+            if (!q.jobs.empty())
+            {
+                out = q.jobs.front();
+                q.jobs.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Wu1Ύs true
+    bool RunOne(std::size_t index)
+    {
+        Job job;
+        if (!PopLocal(index, job) && !Steal(index, job))
+        {
+            return false;
+        }
+        g_queued.fetch_sub(1, std::memory_order_relaxed);
+
+        job.fn(job.ctx, job.begin, job.end);
+        job.remaining->fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    void WorkerLoop(std::size_t index)
+    {
+        t_queueIndex = index;
+        while (g_running.load(std::memory_order_acquire))
+        {
+            if (RunOne(index))
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lk(g_sleepMtx);
+            g_sleepCv.wait(lk, []
+                {
+                    return g_queued.load(std::memory_order_relaxed) > 0 || !g_running.load(std::memory_order_relaxed);
+                });
+        }
+    }
+}
+
+bool JobSystem::Initialize(unsigned workerCount)
+{
+    if (g_running.load())
+    {
+        return true;
+    }
+
+    if (workerCount == 0)
+    {
+        const unsigned hw = std::thread::hardware_concurrency();
+        workerCount = (hw > 1) ? (hw - 1) : 0;
+    }
+
+    g_queues.clear();
+    for (unsigned i = 0; i < workerCount + 1; ++i)
+    {
+        g_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    g_running.store(true);
+    for (unsigned i = 0; i < workerCount; ++i)
+    {
+        g_threads.emplace_back(WorkerLoop, static_cast<std::size_t>(i + 1));
+    }
+    return true;
+}
+
+void JobSystem::Shutdown()
+{
+    if (!g_running.load())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(g_sleepMtx);
+        g_running.store(false);
+    }
+    g_sleepCv.notify_all();
+
+    for (auto& t : g_threads)
+    {
+        t.join();
+    }
+    g_threads.clear();
+    g_queues.clear();
+    g_queued.store(0);
+}
+
+unsigned JobSystem::WorkerCount()
+{
+    return static_cast<unsigned>(g_threads.size());
+}
+
+void JobSystem::ParallelForRaw(std::size_t count, std::size_t grain, RangeFn fn, void* ctx)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const std::size_t threads = g_threads.size() + 1;
+    if (grain == 0)
+    {
+        // 1Xbh4`NxɊĕ΂𓐂݂łȂ炷
+        grain = std::max<std::size_t>(64, count / (threads * 4));
+    }
+
+    // [J[ȂA܂͕قǂ̗ʂ΂̂܂܎s
+    if (!g_running.load(std::memory_order_acquire) || threads == 1 || count <= grain)
+    {
+        fn(ctx, 0, count);
+        return;
+    }
+
+    const std::size_t chunks = (count + grain - 1) / grain;
+    std::atomic<std::size_t> remaining{ chunks };
+
+    const std::size_t self = t_queueIndex;
+    {
+        WorkQueue& q = *g_queues[self];
+        std::lock_guard<std::mutex> lk(q.mtx);
+        for (std::size_t begin = 0; begin < count; begin += grain)
+        {
+            q.jobs.push_back(Job{ fn, ctx, begin, std::min(begin + grain, count), &remaining });
+        }
+    }
+    g_queued.fetch_add(chunks, std::memory_order_relaxed);
+
+    // QĂ郏[J[Niҋ@ g_sleepMtx  g_queued mFĂj
+    {
+        std::lock_guard<std::mutex> lk(g_sleepMtx);
+    }
+    g_sleepCv.notify_all();
+
+    // ĂяoɎQAS`N̊҂
+    while (remaining.load(std::memory_order_acquire) > 0)
+    {
+        if (!RunOne(self))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
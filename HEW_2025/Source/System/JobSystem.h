@@ -0,0 +1,76 @@
+/*****************************************************************//**
+ * @file   JobSystem.h
+ * @brief  [NXeB[ÕWu(Xbh)v[
+ *
+ * eXbhp̃L[AL[͌납(LIFO)A
+ * ɂȂ瑼Xbh̃L[O(FIFO)ŏ܂B
+ * ȗpr World::ParallelView ɂ per-entity ̕słB
+ *
+ * gij:
+ *   // N
+ *   JobSystem::Initialize();      // [J[ȗ (_RA - 1)
+ *
+ *   // Cӂ̏ꏊ [0, count) 𕪊siĂяoXbhɎQA܂Ŗ߂Ȃj
+ *   JobSystem::ParallelFor(count, 0, [&](std::size_t begin, std::size_t end) { ... });
+ *
+ *   // I
+ *   JobSystem::Shutdown();
+ *
+ * (܂̓[J[0)̏ꍇ͌ĂяoXbhŒɎs܂B
+ *
+ * @author E
+ * @date   2025/11/11
+ *********************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace JobSystem
+{
+    /// ͈͏̊֐|C^ictx ̓_{́j
+    using RangeFn = void(*)(void* ctx, std::size_t begin, std::size_t end);
+
+    /**
+     * @brief [J[XbhN
+     * @param workerCount [J[B0 Ȃ (_RA - 1)
+     * @return  true
+     *
+     * - Ăł 2 ڈȍ~͉Ȃ
+     */
+    bool Initialize(unsigned workerCount = 0);
+
+    /**
+     * @brief [J[Xbh~Ĕj
+     *
+     * - s ParallelFor ԂŌĂԂ
+     */
+    void Shutdown();
+
+    /// Ñ[J[iĂяoXbh͊܂܂Ȃj
+    unsigned WorkerCount();
+
+    /**
+     * @brief [0, count)  grain ̃`Nɕ fn(ctx, begin, end) s
+     * @details S`NI܂Ŗ߂܂Bgrain=0 ȂXbh玩Ō߂܂B
+     */
+    void ParallelForRaw(std::size_t count, std::size_t grain, RangeFn fn, void* ctx);
+
+    /**
+     * @brief ParallelForRaw ̃_
+     * @param fn void(std::size_t begin, std::size_t end)
+     *
+     * fn ͕Xbh瓯ɌĂ΂܂B`Nmœf[^֏܂ȂƁB
+     */
+    template <class Fn>
+    void ParallelFor(std::size_t count, std::size_t grain, Fn&& fn)
+    {
+        using FnType = typename std::remove_reference<Fn>::type;
+        ParallelForRaw(count, grain,
+            [](void* ctx, std::size_t begin, std::size_t end)
+            {
+                (*static_cast<FnType*>(ctx))(begin, end);
+            },
+            const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+}
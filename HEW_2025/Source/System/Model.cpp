@@ -2,11 +2,17 @@
 #include "DirectXTex/TextureLoad.h"
 #include "DirectX/ShaderList.h"
 #include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <map>
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 #include <assimp/material.h> 
 #include "System/AssetManager.h"
+#include "System/AnimationInstance.h"
+#include "System/AnimationClip.h"
 
 #ifdef _DEBUG
 #include "Geometory.h"
@@ -108,12 +114,7 @@ float4 main(PS_IN pin) : SV_TARGET
 Model::Model()
 	: m_loadScale(1.0f)
 	, m_loadFlip(None)
-	, m_playNo(ANIME_NONE)
-	, m_blendNo(ANIME_NONE)
-	, m_parametric{ ANIME_NONE, ANIME_NONE }
-	, m_blendTime(0.0f)
-	, m_blendTotalTime(0.0f)
-	, m_parametricBlend(0.0f)
+	, m_skeletonKey(0)
 {
 	// ftHgVF[_[̓Kp
 	if (m_shaderRef == 0)
@@ -238,6 +239,8 @@ bool Model::Load(const char* file, float scale, Flip flip)
 	MakeMesh(pScene, scale, flip);
 	// }eA̍쐬
 	MakeMaterial(pScene, directory);
+	// ǂݍݎ̎p̃XLjOs
+	MakeBindPalette();
 
 	return true;
 }
@@ -246,24 +249,30 @@ bool Model::Load(const char* file, float scale, Flip flip)
 * @brief `
 * @param[in] meshNo `悷郁bVA-1͑S\
 * @param[in] overrideTex ECS w肳ꂽ㏑eNX`
+* @param[in] pose ̎p(nullptr Ȃǂݍݎ̎p)
+* @param[in] overrideVS GeBeBw肳ꂽ_VF[_[(nullptr Ȃ烂f̐ݒ)
 *
 * dlF
 *   - f Material::pTexture uftHgeNX`vƂĎg
 *   - overrideTex  non-null ̂ƂAD悵ď㏑
 */
-void Model::Draw(int meshNo, Texture* overrideTex)
+void Model::Draw(int meshNo, Texture* overrideTex, const AnimationInstance* pose, VertexShader* overrideVS)
 {
 	if (m_pVS == nullptr) { m_pVS = m_pDefVS; }
 	if (m_pPS == nullptr) { m_pPS = m_pDefPS; }
+	VertexShader* pVS = overrideVS ? overrideVS : m_pVS;
+
+	// ʂ̃fp̎p͎gȂ
+	if (pose && !pose->IsBoundTo(this)) { pose = nullptr; }
 
 	// BindOɁAO̕`ŎcĂeNX`NA
 	// sȂƁABindɁuɔjꂽeNX`vZbg悤Ƃ
 	// 0xC0000005 ANZXᔽ
-	m_pVS->ClearTextures();
+	pVS->ClearTextures();
 	m_pPS->ClearTextures();
 
 	// VF[_[ݒ
-	m_pVS->Bind();
+	pVS->Bind();
 	m_pPS->Bind();
 
     const bool isAllMesh = (meshNo == -1);
@@ -321,36 +330,18 @@ void Model::Draw(int meshNo, Texture* overrideTex)
 		}
 		
 		// -----------------------------
-		// 3. XLjOp Bone z쐬
+		// 3. XLjOp Bone z̐ݒ
 		// -----------------------------
-		DirectX::XMFLOAT4X4 boneMats[MAX_BONE];
-
-		const UINT boneCount =
-			static_cast<UINT>(std::min(mesh.bones.size(), static_cast<size_t>(MAX_BONE)));
-
-		for (UINT b = 0; b < boneCount; ++b)
-		{
-			const Bone& bone = mesh.bones[b];
-
-			DirectX::XMMATRIX m = DirectX::XMMatrixIdentity();
-			if (bone.index != INDEX_NONE)
-			{
-				// ŏIXLjOs = offset * ݂̃{[p
-				m = bone.invOffset * m_nodes[bone.index].mat;
-			}
-
-			DirectX::XMStoreFloat4x4(&boneMats[b], DirectX::XMMatrixTranspose(m));
-		}
-
-		// ] Identity Ŗ߂
-		for (UINT b = boneCount; b < MAX_BONE; ++b)
+		// p̍XV(AnimationInstance::Step)ɍĂ̂ÃbVg
+		const std::vector<DirectX::XMFLOAT4X4>& palette = pose ? pose->GetPalette() : m_bindPalette;
+		const UINT paletteOffset = m_paletteOffsets[i];
+		const UINT boneCount = m_paletteOffsets[i + 1] - paletteOffset;
+		if (boneCount > 0 && paletteOffset + boneCount <= palette.size())
 		{
-			DirectX::XMStoreFloat4x4(&boneMats[b], DirectX::XMMatrixIdentity());
+			// HLSL  cbuffer Bone ɏ
+			ShaderList::SetBones(&palette[paletteOffset], boneCount);
 		}
 
-		// HLSL  cbuffer Bone ɏ
-		ShaderList::SetBones(boneMats);
-
 		// -----------------------------
 		// 4. bV`
 		// -----------------------------
@@ -406,33 +397,49 @@ uint32_t Model::GetMaterialNum()
 }
 
 /*
-* @brief Aj[V̕ϊs擾
+* @brief ǂݍݎ̕ϊs擾(Aj[V̎p AnimationInstance::GetBone)
 * @param[in] index {[ԍ
 * @return Y{[̕ϊs
 */
-DirectX::XMMATRIX Model::GetBone(NodeIndex index)
+DirectX::XMMATRIX Model::GetBone(NodeIndex index) const
 {
-	if (index < m_nodes.size())
+	if (0 <= index && index < static_cast<NodeIndex>(m_nodes.size()))
 	{
 		return m_nodes[index].mat;
 	}
 	return DirectX::XMMatrixIdentity();
 }
 
+/*
+* @brief {[(Kw)擾
+*/
+uint32_t Model::GetNodeNum() const
+{
+	return static_cast<uint32_t>(m_nodes.size());
+}
+
 /*
 * @brief Aj[V擾
 * @param[in] no Ajԍ
 * @return YAj[V
 */
-const Model::Animation* Model::GetAnimation(AnimeNo no)
+const Model::Animation* Model::GetAnimation(AnimeNo no) const
 {
-	if (AnimeNoCheck(no))
+	if (0 <= no && no < static_cast<AnimeNo>(m_animes.size()))
 	{
 		return &m_animes[no];
 	}
 	return nullptr;
 }
 
+/*
+* @brief Aj[V擾
+*/
+uint32_t Model::GetAnimationNum() const
+{
+	return static_cast<uint32_t>(m_animes.size());
+}
+
 
 /*
 * @brief Aj[Vǂݍ
@@ -445,404 +452,186 @@ Model::AnimeNo Model::AddAnimation(const char* file)
 	m_errorStr = "";
 #endif
 
-	// assimp̐ݒ
-	Assimp::Importer importer;
-	int flag = 0;
-	flag |= aiProcess_Triangulate;
-	flag |= aiProcess_FlipUVs;
-	// n(DirectX)ֈꊇϊBfǂݍݎƑB
-	flag |= aiProcess_ConvertToLeftHanded;
-	//if (m_loadFlip == Flip::XFlip)  flag |= aiProcess_MakeLeftHanded;
-
-	// assimpœǂݍ
-	const aiScene* pScene = importer.ReadFile(file, flag);
-	if (!pScene)
+	// t@Cǂݍݍς݂ȂA̔ԍԂ(̃GeBeBŋL邽)
+	for (size_t i = 0; i < m_animes.size(); ++i)
 	{
-#ifdef _DEBUG
-		m_errorStr += importer.GetErrorString();
-#endif
-		return ANIME_NONE;
+		if (m_animes[i].source == file)
+		{
+			return static_cast<AnimeNo>(i);
+		}
 	}
 
-	// Aj[V`FbN
-	if (!pScene->HasAnimations())
+	// ͍ς݂̃L[̓pXƂɃLbVĂ
+	AssetHandle<AnimationClip> clip = AssetManager::GetAnimationClip(file);
+	if (!clip)
 	{
 #ifdef _DEBUG
-		m_errorStr += "no animation.";
+		m_errorStr += std::string("failed to load animation: ") + file;
 #endif
 		return ANIME_NONE;
 	}
-
-	// Aj[Vf[^m
-	aiAnimation* assimpAnime = pScene->mAnimations[0];
-	m_animes.push_back(Animation());
-	Animation& anime = m_animes.back();
-
-	// Aj[Vݒ
-	float animeFrame = static_cast<float>(assimpAnime->mTicksPerSecond);
-	anime.totalTime = static_cast<float>(assimpAnime->mDuration) / animeFrame;
-	anime.channels.resize(assimpAnime->mNumChannels);
-	Channels::iterator channelIt = anime.channels.begin();
-	while (channelIt != anime.channels.end())
-	{
-		// Ή`l({[)T
-		uint32_t channelIdx = static_cast<uint32_t>(channelIt - anime.channels.begin());
-		aiNodeAnim* assimpChannel = assimpAnime->mChannels[channelIdx];
-		Model::Nodes::iterator nodeIt = std::find_if(m_nodes.begin(), m_nodes.end(),
-			[assimpChannel](Node& node) {
-				return node.name == assimpChannel->mNodeName.data;
-			});
-		if (nodeIt == m_nodes.end())
-		{
-			channelIt->index = INDEX_NONE;
-			++channelIt;
-			continue;
-		}
-
-		// eL[̒lݒ
-		channelIt->index = static_cast<NodeIndex>(nodeIt - m_nodes.begin());
-		Timeline& timeline = channelIt->timeline;
-
-		// xXMVECTOR^Ŋi[
-		using XMVectorKey = std::pair<float, DirectX::XMVECTOR>;
-		using XMVectorKeys = std::map<float, DirectX::XMVECTOR>;
-		XMVectorKeys keys[3];
-		// ʒu
-		for (UINT i = 0; i < assimpChannel->mNumPositionKeys; ++i)
-		{
-			aiVectorKey& key = assimpChannel->mPositionKeys[i];
-			keys[0].insert(XMVectorKey(static_cast<float>(key.mTime) / animeFrame,
-				DirectX::XMVectorSet(key.mValue.x, key.mValue.y, key.mValue.z, 0.0f)
-			));
-		}
-		// ]
-		for (UINT i = 0; i < assimpChannel->mNumRotationKeys; ++i)
-		{
-			aiQuatKey& key = assimpChannel->mRotationKeys[i];
-			keys[1].insert(XMVectorKey(static_cast<float>(key.mTime) / animeFrame,
-				DirectX::XMVectorSet(key.mValue.x, key.mValue.y, key.mValue.z, key.mValue.w)));
-		}
-		// gk
-		for (UINT i = 0; i < assimpChannel->mNumScalingKeys; ++i)
-		{
-			aiVectorKey& key = assimpChannel->mScalingKeys[i];
-			keys[2].insert(XMVectorKey(static_cast<float>(key.mTime) / animeFrame,
-				DirectX::XMVectorSet(key.mValue.x, key.mValue.y, key.mValue.z, 0.0f)));
-		}
-
-		// e^CC̐擪̎QƂݒ
-		XMVectorKeys::iterator it[] = { keys[0].begin(), keys[1].begin(), keys[2].begin() };
-		for (int i = 0; i < 3; ++i)
-		{
-			// L[Ȃꍇ́AQƏI
-			if (keys[i].size() == 1)
-				++it[i];
-		}
-
-		// evfƂ̃^CCł͂ȂAׂĂ̕ϊ܂߂^CC̍쐬
-		while (it[0] != keys[0].end() && it[1] != keys[1].end() && it[2] != keys[2].end())
-		{
-			// ̎QƈʒuňԏԂ擾
-			float time = anime.totalTime;
-			for (int i = 0; i < 3; i++)
-			{
-				if (it[i] != keys[i].end())
-				{
-					time = std::min(it[i]->first, time);
-				}
-			}
-
-			// ԂɊÂĕԒlvZ
-			DirectX::XMVECTOR result[3];
-			for (int i = 0; i < 3; ++i)
-			{
-				// 擪̃L[菬Ԃł΁A擪̒lݒ
-				if (time < keys[i].begin()->first)
-				{
-					result[i] = keys[i].begin()->second;
-				}
-				// ŏIL[傫Ԃł΁AŏI̒lݒ
-				else if (keys[i].rbegin()->first <= time)
-				{
-					result[i] = keys[i].rbegin()->second;
-					it[i] = keys[i].end();
-				}
-				// L[mɋ܂ꂽԂł΁AԒlvZ
-				else
-				{
-					// QƂĂ鎞ԂƓł΁A̎Qrefer to i
-					if (it[i]->first <= time)
-					{
-						++it[i];
-					}
-
-					// ԒľvZ
-					XMVectorKeys::iterator prev = it[i];
-					--prev;
-					float rate = (time - prev->first) / (it[i]->first - prev->first);
-					result[i] = DirectX::XMVectorLerp(prev->second, it[i]->second, rate);
-				}
-			}
-
-			// w莞ԂɊÂL[ǉ
-			Transform transform;
-			DirectX::XMStoreFloat3(&transform.translate, result[0]);
-			DirectX::XMStoreFloat4(&transform.quaternion, result[1]);
-			DirectX::XMStoreFloat3(&transform.scale, result[2]);
-			timeline.insert(Key(time, transform));
-		}
-
-		++channelIt;
-	}
-
-	// AjԍԂ
-	return static_cast<AnimeNo>(m_animes.size() - 1);
+	return AddAnimation(clip.Get());
 }
 
 /*
-* @brief Aj[V̍XV
-* @param[in] tick Aj[Voߎ
+* @brief ǂݍݍς݂̃Aj[Vǉ
+* @param[in] clip AssetManager::GetAnimationClip Ŏ擾Nbv
+* @return Ŋ蓖ĂꂽAj[Vԍ
 */
-void Model::Step(float tick)
+Model::AnimeNo Model::AddAnimation(const std::shared_ptr<const AnimationClip>& clip)
 {
-	// Aj[V̍ĐmF
-	if (m_playNo == ANIME_NONE) { return; }
-
-	//--- Aj[Vs̍XV
-	// pgbN
-	if (m_playNo == PARAMETRIC_ANIME || m_blendNo == PARAMETRIC_ANIME)
-	{
-		CalcAnime(PARAMETRIC0, m_parametric[0]);
-		CalcAnime(PARAMETRIC1, m_parametric[1]);
-	}
-	// CAj
-	if (m_playNo != ANIME_NONE && m_playNo != PARAMETRIC_ANIME)
-	{
-		CalcAnime(MAIN, m_playNo);
-	}
-	// uhAj
-	if (m_blendNo != ANIME_NONE && m_blendNo != PARAMETRIC_ANIME)
-	{
-		CalcAnime(BLEND, m_blendNo);
-	}
-
-	// Aj[VsɊÂčsXV
-	CalcBones(0, DirectX::XMMatrixScaling(m_loadScale, m_loadScale, m_loadScale));
+	if (!clip) { return ANIME_NONE; }
 
-	//--- Aj[V̎ԍXV
-	// CAj
-	UpdateAnime(m_playNo, tick);
-
-	// uhAj
-	if (m_blendNo != ANIME_NONE)
+	for (size_t i = 0; i < m_animes.size(); ++i)
 	{
-		UpdateAnime(m_blendNo, tick);
-
-		if (m_blendTotalTime > 0.0f)
+		if (m_animes[i].clip == clip)
 		{
-			// oߎԂi߂iNvtj
-			m_blendTime += tick;
-			if (m_blendTime >= m_blendTotalTime)
-			{
-				// uhI  uhCɏi
-				m_blendTime = 0.0f;
-				m_blendTotalTime = 0.0f;
-				m_playNo = m_blendNo;
-				m_blendNo = ANIME_NONE;
-			}
+			return static_cast<AnimeNo>(i);
 		}
 	}
 
-	// pgbN
-	if (m_playNo == PARAMETRIC_ANIME || m_blendNo == PARAMETRIC_ANIME)
-	{
-		UpdateAnime(m_parametric[0], tick);
-		UpdateAnime(m_parametric[1], tick);
-	}
-}
-
-
-/*
-* @brief Aj[VĐ
-* @param[in] no ĐAj[Vԍ
-* @param[in] loop [vĐtO
-* @param[in] speed Đx
-*/
-void Model::Play(AnimeNo no, bool loop, float speed)
-{
-	// Đ`FbN
-	if (!AnimeNoCheck(no)) { return; }
-	if (m_playNo == no) { return; }
+	// L[̓Nbv̂̂wŁARs[Ȃ
+	const AnimationClip::Tracks& tracks = clip->GetTracks();
+	const AnimationClip::NodeIndices& indices = clip->GetNodeIndices(*this);
 
-	// Aj[V`FbN
-	if (no != PARAMETRIC_ANIME)
-	{
-		// ʏ̏
-		InitAnime(no);
-		m_animes[no].isLoop = loop;
-		m_animes[no].speed = speed;
-	}
-	else
+	m_animes.push_back(Animation());
+	Animation& anime = m_animes.back();
+	anime.source = clip->GetSource();
+	anime.totalTime = clip->GetTotalTime();
+	anime.clip = clip;
+	anime.channels.resize(tracks.size());
+	for (size_t i = 0; i < tracks.size(); ++i)
 	{
-		// Aj[V̌ɂȂĂAj[V
-		InitAnime(m_parametric[0]);
-		InitAnime(m_parametric[1]);
-		m_animes[m_parametric[0]].isLoop = loop;
-		m_animes[m_parametric[1]].isLoop = loop;
-		SetParametricBlend(0.0f);
+		anime.channels[i].index = indices[i];
+		anime.channels[i].pTimeline = &tracks[i].timeline;
 	}
 
-	// ĐAj[V̐ݒ
-	m_playNo = no;
+	// AjԍԂ
+	return static_cast<AnimeNo>(m_animes.size() - 1);
 }
 
 /*
-* @brief uhĐ
-* @param[in] no Aj[Vԍ
-* @param[in] blendTime uhɊ|鎞
-* @param[in] loop [vtO
-* @param[in] speed Đx
+* @brief L[𖖔ɒǉ(ԏɌĂԂƁBԂ̃L[͐ɒǉ̂c)
 */
-void Model::PlayBlend(AnimeNo no, float blendTime, bool loop, float speed)
+void Model::Timeline::Push(float time, const Transform& transform)
 {
-	// Đ`FbN
-	if (!AnimeNoCheck(no)) { return; }
-
-	// Aj[V`FbN
-	if (no != PARAMETRIC_ANIME)
-	{
-		InitAnime(no);
-		m_animes[no].isLoop = loop;
-		m_animes[no].speed = speed;
-	}
-	else
-	{
-		// Aj[V̌ɂȂĂAj[V
-		InitAnime(m_parametric[0]);
-		InitAnime(m_parametric[1]);
-		m_animes[m_parametric[0]].isLoop = loop;
-		m_animes[m_parametric[1]].isLoop = loop;
-		SetParametricBlend(0.0f);
-	}
+	if (!times.empty() && time <= times.back()) { return; }
 
-	// uh̐ݒ
-	m_blendTime = 0.0f;
-	m_blendTotalTime = blendTime;
-	m_blendNo = no;
+	times.push_back(time);
+	translates.push_back(transform.translate);
+	quaternions.push_back(transform.quaternion);
+	scales.push_back(transform.scale);
 }
 
 /*
-* @brief Aj[V̐ݒ
-* @param[in] no1 Aj1
-* @param[in] no2 Aj2
+* @brief key Ԗڂ̃L[̒l擾
 */
-void Model::SetParametric(AnimeNo no1, AnimeNo no2)
+void Model::Timeline::Get(size_t key, Transform* pOut) const
 {
-	// Aj[V`FbN
-	if (!AnimeNoCheck(no1)) { return; }
-	if (!AnimeNoCheck(no2)) { return; }
-
-	// ݒ
-	m_parametric[0] = no1;
-	m_parametric[1] = no2;
-	SetParametricBlend(0.0f);
+	pOut->translate = translates[key];
+	pOut->quaternion = quaternions[key];
+	pOut->scale = scales[key];
 }
 
 /*
-* @brief Aj[V̍ݒ
-* @param[in] blendRate 
+* @brief L[Ԃ̃x`}[N
+* @param[in] frames 1NbṽTvO
+* @param[in] tick 1񂠂ɐi߂鎞
+* @return v
+* @details eNbv擪烋[vĐꍇƓԗŁA
+*          ] std::map + upper_bound ƁAz + Đʒu̎zׂ
 */
-void Model::SetParametricBlend(float blendRate)
+Model::SampleBenchmarkResult Model::RunSampleBenchmark(int frames, float tick) const
 {
-	// Ajݒ肳Ă邩mF
-	if (m_parametric[0] == ANIME_NONE || m_parametric[1] == ANIME_NONE) return;
-
-	// ݒ
-	m_parametricBlend = blendRate;
-
-	// ɊÂăAj[V̍Đxݒ
-	Animation& anime1 = m_animes[m_parametric[0]];
-	Animation& anime2 = m_animes[m_parametric[1]];
-	float blendTotalTime = anime1.totalTime * (1.0f - m_parametricBlend) + anime2.totalTime * m_parametricBlend;
-	anime1.speed = anime1.totalTime / blendTotalTime;
-	anime2.speed = anime2.totalTime / blendTotalTime;
-}
+	using Clock = std::chrono::steady_clock;
+	using MapTimeline = std::map<float, Transform>;
 
-/*
-* @brief Aj[V̍ĐԂύX
-* @param[in] no ύXAj
-* @param[in] time VĐ
-*/
-void Model::SetAnimationTime(AnimeNo no, float time)
-{
-	// Aj[V`FbN
-	if (!AnimeNoCheck(no)) { return; }
+	SampleBenchmarkResult result;
+	Transforms mapOut(m_nodes.size());
+	Transforms flatOut(m_nodes.size());
 
-	// ĐԕύX
-	Animation& anime = m_animes[no];
-	anime.nowTime = time;
-	while (anime.nowTime >= anime.totalTime)
+	for (const Animation& anime : m_animes)
 	{
-		anime.nowTime -= anime.totalTime;
-	}
-}
-
-void Model::StopAnimation()
-{
-	// Đ̃AjׂăZbg
-	m_playNo = ANIME_NONE;
-	m_blendNo = ANIME_NONE;
-	m_blendTime = 0.0f;
-	m_blendTotalTime = 0.0f;
-}
-
+		if (anime.totalTime <= 0.0f) { continue; }
+		++result.clipCount;
 
+		// rpɏ]̌`֖߂
+		std::vector<MapTimeline> maps(anime.channels.size());
+		for (size_t c = 0; c < anime.channels.size(); ++c)
+		{
+			const Timeline& timeline = *anime.channels[c].pTimeline;
+			for (size_t k = 0; k < timeline.size(); ++k)
+			{
+				Transform transform;
+				timeline.Get(k, &transform);
+				maps[c].emplace(timeline.times[k], transform);
+			}
+		}
+		std::vector<uint32_t> cursors(anime.channels.size(), 0);
 
-/*
-* @brief ĐtO̎擾
-* @param[in] no ׂAjԍ
-* @return ݍĐȂtrue
-*/
-bool Model::IsPlay(AnimeNo no)
-{
-	// Aj[V`FbN
-	if (!AnimeNoCheck(no)) { return false; }
+		// ]: std::map + upper_bound
+		float time = 0.0f;
+		auto t0 = Clock::now();
+		for (int f = 0; f < frames; ++f)
+		{
+			for (size_t c = 0; c < anime.channels.size(); ++c)
+			{
+				const Channel& channel = anime.channels[c];
+				const MapTimeline& timeline = maps[c];
+				if (channel.index == INDEX_NONE || timeline.empty()) { continue; }
 
-	// pgbÑ͍Ajɔf
-	if (no == PARAMETRIC_ANIME) { no = m_parametric[0]; }
+				Transform& transform = mapOut[channel.index];
+				if (timeline.size() <= 1 || time <= timeline.begin()->first)
+				{
+					transform = timeline.begin()->second;
+				}
+				else if (timeline.rbegin()->first <= time)
+				{
+					transform = timeline.rbegin()->second;
+				}
+				else
+				{
+					MapTimeline::const_iterator nextIt = timeline.upper_bound(time);
+					MapTimeline::const_iterator startIt = std::prev(nextIt);
+					float rate = (time - startIt->first) / (nextIt->first - startIt->first);
+					LerpTransform(&transform, startIt->second, nextIt->second, rate);
+				}
+			}
+			time += tick;
+			while (time >= anime.totalTime) { time -= anime.totalTime; }
+		}
+		auto t1 = Clock::now();
+		result.mapMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
 
-	// ĐԂ̔
-	if (m_animes[no].totalTime < m_animes[no].nowTime) { return false; }
+		// z + Đʒu̎z
+		time = 0.0f;
+		t0 = Clock::now();
+		for (int f = 0; f < frames; ++f)
+		{
+			for (size_t c = 0; c < anime.channels.size(); ++c)
+			{
+				const Channel& channel = anime.channels[c];
+				if (channel.index == INDEX_NONE || channel.pTimeline->empty()) { continue; }
+				SampleTimeline(*channel.pTimeline, time, &cursors[c], &flatOut[channel.index]);
+			}
+			time += tick;
+			while (time >= anime.totalTime) { time -= anime.totalTime; }
+		}
+		t1 = Clock::now();
+		result.flatMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
 
-	// ꂼ̍Đԍɐݒ肳Ă邩mF
-	if (m_playNo == no) { return true; }
-	if (m_blendNo == no) { return true; }
-	if (m_playNo == PARAMETRIC_ANIME || m_blendNo == PARAMETRIC_ANIME)
-	{
-		if (m_parametric[0] == no) { return true; }
-		if (m_parametric[1] == no) { return true; }
+		// Ō̃t[̌ʂׂ
+		for (const Channel& channel : anime.channels)
+		{
+			if (channel.index == INDEX_NONE || channel.pTimeline->empty()) { continue; }
+			++result.channelCount;
+			const Transform& a = mapOut[channel.index];
+			const Transform& b = flatOut[channel.index];
+			if (memcmp(&a, &b, sizeof(Transform)) != 0) { result.match = false; }
+		}
+		result.sampleCount += static_cast<size_t>(frames) * anime.channels.size();
 	}
-
-	// ĐłȂ
-	return false;
-}
-
-/*
-* @brief Đ̔ԍ̎擾
-* @return Ajԍ
-*/
-Model::AnimeNo Model::GetPlayNo()
-{
-	return m_playNo;
-}
-
-/*
-* @brief Đ̃uhAj̎擾
-* @return Ajԍ
-*/
-Model::AnimeNo Model::GetBlendNo()
-{
-	return m_blendNo;
+	return result;
 }
 
 
@@ -859,29 +648,23 @@ std::string Model::GetError()
 
 /*
 * @brief {[fobO`
+* @param[in] pose ̎p(nullptr Ȃǂݍݎ̎p)
 */
-void Model::DrawBone()
+void Model::DrawBone(const AnimationInstance* pose)
 {
-	// ċA
-	std::function<void(int, DirectX::XMFLOAT3)> FuncDrawBone =
-		[&FuncDrawBone, this](int idx, DirectX::XMFLOAT3 parent)
-		{
-			// em[h猻݈ʒu܂ŕ`
-			DirectX::XMFLOAT3 pos;
-			DirectX::XMStoreFloat3(&pos, DirectX::XMVector3TransformCoord(DirectX::XMVectorZero(), m_nodes[idx].mat));
-			Geometory::AddLine(parent, pos, DirectX::XMFLOAT4(1.0f, 0.0f, 0.0f, 1.0f));
-
-			// qm[h̕`
-			auto it = m_nodes[idx].children.begin();
-			while (it != m_nodes[idx].children.end())
-			{
-				FuncDrawBone(*it, pos);
-				++it;
-			}
-		};
+	if (pose && !pose->IsBoundTo(this)) { pose = nullptr; }
+
+	// e͎qOɂ̂ŁAO珇ɐëʒuƌ
+	std::vector<DirectX::XMFLOAT3> positions(m_nodes.size());
+	for (size_t idx = 0; idx < m_nodes.size(); ++idx)
+	{
+		const DirectX::XMMATRIX mat = pose ? pose->GetBone(static_cast<NodeIndex>(idx)) : m_nodes[idx].mat;
+		DirectX::XMStoreFloat3(&positions[idx], DirectX::XMVector3TransformCoord(DirectX::XMVectorZero(), mat));
 
-	// `s
-	FuncDrawBone(0, DirectX::XMFLOAT3());
+		const NodeIndex parent = m_nodeParents[idx];
+		const DirectX::XMFLOAT3 from = (parent == INDEX_NONE) ? DirectX::XMFLOAT3() : positions[parent];
+		Geometory::AddLine(from, positions[idx], DirectX::XMFLOAT4(1.0f, 0.0f, 0.0f, 1.0f));
+	}
 	Geometory::DrawLines();
 }
 
@@ -930,19 +713,29 @@ void Model::MakeBoneNodes(const void* ptr)
 		};
 
 	// m[h쐬
+	// ǉĂqǂ̂ŁAe͕KqOɕ
 	m_nodes.clear();
 	FuncAssimpNodeConvert(pScene->mRootNode, INDEX_NONE, DirectX::XMMatrixIdentity());
 
-	// Aj[VvZ̈ɁAm[h̏f[^쐬
-	Transform init = {
-		DirectX::XMFLOAT3(0.0f, 0.0f, 0.0f),
-		DirectX::XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f), //  ͊ɒĂ͂
-		DirectX::XMFLOAT3(1.0f, 1.0f, 1.0f)
-	};
-	for (int i = 0; i < MAX_TRANSFORM; ++i)
+	// eԍׂz(AnimationInstance O珇ɍs߂)
+	m_nodeParents.resize(m_nodes.size());
+	for (size_t i = 0; i < m_nodes.size(); ++i)
+	{
+		m_nodeParents[i] = m_nodes[i].parent;
+		assert(m_nodeParents[i] < static_cast<NodeIndex>(i));
+	}
+
+	// m[h̕т獜i̎ʒl(FNV-1a)BAnimationClip ͊蓖Ă̒lňAO̕тŏƍ
+	m_skeletonKey = 14695981039346656037ull;
+	for (const Node& node : m_nodes)
 	{
-		m_nodeTransform[i].resize(m_nodes.size(), init);
+		for (const char c : node.name)
+		{
+			m_skeletonKey = (m_skeletonKey ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+		}
+		m_skeletonKey = (m_skeletonKey ^ 0xFFull) * 1099511628211ull;	// Ő؂
 	}
+
 }
 
 void Model::MakeWeight(const void* ptr, int meshIdx)
@@ -1068,143 +861,108 @@ void Model::MakeWeight(const void* ptr, int meshIdx)
 
 
 
-bool Model::AnimeNoCheck(AnimeNo no)
+/*
+* @brief bVƂ̃XLjOs̕т߁Aǂݍݎ̎pō쐬
+*/
+void Model::MakeBindPalette()
 {
-	// pgbNAj[VmF
-	if (no == PARAMETRIC_ANIME)
+	m_paletteOffsets.assign(1, 0);
+	for (const Mesh& mesh : m_meshes)
 	{
-		// pgbÑAj[Vݒ肳Ă邩
-		return
-			m_parametric[0] != ANIME_NONE &&
-			m_parametric[1] != ANIME_NONE;
+		const UINT boneCount = static_cast<UINT>(std::min(mesh.bones.size(), static_cast<size_t>(MAX_BONE)));
+		m_paletteOffsets.push_back(m_paletteOffsets.back() + boneCount);
 	}
-	else
+
+	std::vector<DirectX::XMMATRIX> bindPose(m_nodes.size());
+	for (size_t i = 0; i < m_nodes.size(); ++i)
 	{
-		// ȂAj[Vԍǂ
-		return 0 <= no && no < m_animes.size();
+		bindPose[i] = m_nodes[i].mat;
 	}
+	MakePalette(bindPose.data(), m_bindPalette);
 }
-void Model::InitAnime(AnimeNo no)
-{
-	// Aj̐ݒȂApgbNŐݒ肳ĂȂ珉Ȃ
-	if (no == ANIME_NONE || no == PARAMETRIC_ANIME) { return; }
 
-	Animation& anime = m_animes[no];
-	anime.nowTime = 0.0f;
-	anime.speed = 1.0f;
-	anime.isLoop = false;
-}
-void Model::CalcAnime(AnimeTransform kind, AnimeNo no)
+/*
+* @brief pXLjOs쐬
+* @param[in] pose m[hƂ̎p(m_nodes Ɠ)
+* @param[out] palette SbṼXLjOs(]uς)BbV i ̍ m_paletteOffsets[i] 
+*/
+void Model::MakePalette(const DirectX::XMMATRIX* pose, std::vector<DirectX::XMFLOAT4X4>& palette) const
 {
-	Animation& anime = m_animes[no];
-	Channels::iterator channelIt = anime.channels.begin();
-	while (channelIt != anime.channels.end())
+	palette.resize(m_paletteOffsets.empty() ? 0 : m_paletteOffsets.back());
+	for (size_t i = 0; i < m_meshes.size() && i + 1 < m_paletteOffsets.size(); ++i)
 	{
-		// v{[Ȃ΃XLbv
-		Timeline& timeline = channelIt->timeline;
-		if (channelIt->index == INDEX_NONE || timeline.empty())
+		const Mesh& mesh = m_meshes[i];
+		const UINT offset = m_paletteOffsets[i];
+		const UINT boneCount = m_paletteOffsets[i + 1] - offset;
+		for (UINT b = 0; b < boneCount; ++b)
 		{
-			++channelIt;
-			continue;
-		}
+			const Bone& bone = mesh.bones[b];
 
-		//--- Ym[h̎pAj[VōXV
-		Transform& transform = m_nodeTransform[kind][channelIt->index];
-		if (timeline.size() <= 1)
-		{
-			// L[Ȃ̂Œl̂܂܎gp
-			transform = channelIt->timeline[0];
-		}
-		else
-		{
-			Timeline::iterator startIt = timeline.begin();
-			if (anime.nowTime <= startIt->first)
-			{
-				// 擪L[O̎ԂȂA擪̒lgp
-				transform = startIt->second;
-			}
-			else if (timeline.rbegin()->first <= anime.nowTime)
-			{
-				// ŏIL[̎ԂȂAŌ̒lgp
-				transform = timeline.rbegin()->second;
-			}
-			else
+			DirectX::XMMATRIX m = DirectX::XMMatrixIdentity();
+			if (bone.index != INDEX_NONE)
 			{
-				// w肳ꂽԂ2̃L[AԂꂽlvZ
-				Timeline::iterator nextIt = timeline.upper_bound(anime.nowTime);
-				startIt = nextIt;
-				--startIt;
-				float rate = (anime.nowTime - startIt->first) / (nextIt->first - startIt->first);
-				LerpTransform(&transform, startIt->second, nextIt->second, rate);
+				// ŏIXLjOs = offset * ݂̃{[p
+				m = bone.invOffset * pose[bone.index];
 			}
-		}
 
-		++channelIt;
+			DirectX::XMStoreFloat4x4(&palette[offset + b], DirectX::XMMatrixTranspose(m));
+		}
 	}
 }
-void Model::UpdateAnime(AnimeNo no, float tick)
+
+/*
+* @brief w莞Ԃ̎pL[Ԃ
+* @param[in] timeline L[̕
+* @param[in] time 
+* @param[in,out] pCursor ÕL[ԍBԂi񂾂ȂA𐔌邾ōς
+* @param[out] pOut Ԍ
+*/
+void Model::SampleTimeline(const Timeline& timeline, float time, uint32_t* pCursor, Transform* pOut)
 {
-	if (no == PARAMETRIC_ANIME) { return; }
+	const std::vector<float>& times = timeline.times;
+	const size_t last = times.size() - 1;
 
-	Animation& anime = m_animes[no];
-	anime.nowTime += anime.speed * tick;
-	if (anime.isLoop)
+	// L[Ȃ / 擪L[O̎ԂȂA擪̒lgp
+	if (last == 0 || time <= times[0])
 	{
-		while (anime.nowTime >= anime.totalTime)
-		{
-			anime.nowTime -= anime.totalTime;
-		}
+		*pCursor = 0;
+		timeline.Get(0, pOut);
+		return;
 	}
-}
-void Model::CalcBones(NodeIndex index, const DirectX::XMMATRIX parent)
-{
-	//--- Aj[VƂ̃p[^
-	Transform transform;
-	// pgbN
-	if (m_playNo == PARAMETRIC_ANIME || m_blendNo == PARAMETRIC_ANIME)
+	// ŏIL[̎ԂȂAŌ̒lgp
+	if (times[last] <= time)
 	{
-		LerpTransform(&transform, m_nodeTransform[PARAMETRIC0][index], m_nodeTransform[PARAMETRIC1][index], m_parametricBlend);
-		if (m_playNo == PARAMETRIC_ANIME)
-		{
-			m_nodeTransform[MAIN][index] = transform;
-		}
-		if (m_blendNo == PARAMETRIC_ANIME)
-		{
-			m_nodeTransform[BLEND][index] = transform;
-		}
+		*pCursor = static_cast<uint32_t>(last - 1);
+		timeline.Get(last, pOut);
+		return;
 	}
-	// uhAj
-	if (m_blendNo != ANIME_NONE && m_blendTotalTime > 0.0f)
+
+	// w肳ꂽԂ2̃L[T
+	size_t key = *pCursor;
+	if (key >= last || time < times[key])
 	{
-		float t = std::clamp(m_blendTime / m_blendTotalTime, 0.0f, 1.0f);
-		LerpTransform(&transform,
-			m_nodeTransform[MAIN][index],
-			m_nodeTransform[BLEND][index],
-			t);
+		// [vĐԂ̕ύXŖ߂ꍇ͒T
+		key = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
 	}
 	else
 	{
-		// CAĵ
-		transform = m_nodeTransform[MAIN][index];
+		// ʏ͂̂܂܂A1iނ
+		while (times[key + 1] <= time)
+		{
+			++key;
+		}
 	}
+	*pCursor = static_cast<uint32_t>(key);
 
-
-	// Ym[h̎psvZ
-	Node& node = m_nodes[index];
-	DirectX::XMMATRIX T = DirectX::XMMatrixTranslationFromVector(DirectX::XMLoadFloat3(&transform.translate));
-	DirectX::XMMATRIX R = DirectX::XMMatrixRotationQuaternion(DirectX::XMLoadFloat4(&transform.quaternion));
-	DirectX::XMMATRIX S = DirectX::XMMatrixScalingFromVector(DirectX::XMLoadFloat3(&transform.scale));
-	node.mat = (S * R * T) * parent;
-
-	// qvf̎pXV
-	Children::iterator it = node.children.begin();
-	while (it != node.children.end())
-	{
-		CalcBones(*it, node.mat);
-		++it;
-	}
+	// 2̃L[AԂꂽlvZ
+	const float rate = (time - times[key]) / (times[key + 1] - times[key]);
+	DirectX::XMStoreFloat3(&pOut->translate, DirectX::XMVectorLerp(
+		DirectX::XMLoadFloat3(&timeline.translates[key]), DirectX::XMLoadFloat3(&timeline.translates[key + 1]), rate));
+	DirectX::XMStoreFloat4(&pOut->quaternion, DirectX::XMVectorLerp(
+		DirectX::XMLoadFloat4(&timeline.quaternions[key]), DirectX::XMLoadFloat4(&timeline.quaternions[key + 1]), rate));
+	DirectX::XMStoreFloat3(&pOut->scale, DirectX::XMVectorLerp(
+		DirectX::XMLoadFloat3(&timeline.scales[key]), DirectX::XMLoadFloat3(&timeline.scales[key + 1]), rate));
 }
-
 void Model::LerpTransform(Transform* pOut, const Transform& a, const Transform& b, float rate)
 {
 	DirectX::XMVECTOR vec[][2] = {
@@ -1,6 +1,10 @@
 /*
 * @brief
 * @ Aj[VƂ
+*
+* Model ͓ǂݍ񂾃bVE}eAEiEAj[VLf[^ŁA
+* ǂݍ݌͏ȂiAssetManager::GetModel œ̂g񂷁jB
+* ĐԂuhԁA̎p̓GeBeBƂ AnimationInstance B
 */
 #ifndef __MODEL_H__
 #define __MODEL_H__
@@ -9,10 +13,19 @@
 #include <vector>
 #include "System/DirectX/Shader.h"
 #include "System/DirectX/MeshBuffer.h"
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <string>
+
+class AnimationInstance;
+class AnimationClip;
 
 class Model
 {
+	friend class AnimationInstance;
+	friend class AnimationClip;
+
 public:
 	// f]ݒ
 	enum Flip
@@ -23,17 +36,6 @@ public:
 		ZFlipUseAnime,	// DirecX(Aj[Vꍇ
 	};
 
-private:
-	// Aj[VvZ̈
-	enum AnimeTransform
-	{
-		MAIN,			// ʏĐ
-		BLEND,			// uhĐ
-		PARAMETRIC0,	// A
-		PARAMETRIC1,	// B
-		MAX_TRANSFORM
-	};
-
 public:
 	// ^`
 	using NodeIndex = int;	// {[(Kw)ԍ
@@ -58,15 +60,27 @@ private:
 		DirectX::XMFLOAT4	quaternion;
 		DirectX::XMFLOAT3	scale;
 	};
-	using Key = std::pair<float, Transform>;
-	using Timeline = std::map<float, Transform>;
 	using Transforms = std::vector<Transform>;
 
+	// L[̕(ԏ)BvfƂɕʂ̔zŎAtimes[i] ̒l translates[i] Ȃǂɓ
+	struct Timeline
+	{
+		std::vector<float>				times;
+		std::vector<DirectX::XMFLOAT3>	translates;
+		std::vector<DirectX::XMFLOAT4>	quaternions;
+		std::vector<DirectX::XMFLOAT3>	scales;
+
+		size_t size() const { return times.size(); }
+		bool empty() const { return times.empty(); }
+		void Push(float time, const Transform& transform);
+		void Get(size_t key, Transform* pOut) const;
+	};
+
 	// Aj[Vƃ{[̊֘At
 	struct Channel
 	{
-		NodeIndex	index;
-		Timeline	timeline;
+		NodeIndex		index;
+		const Timeline*	pTimeline;	// L[(AnimationClip )
 	};
 	using Channels = std::vector<Channel>;
 
@@ -76,7 +90,7 @@ private:
 		std::string			name;		// {[
 		NodeIndex			parent;		// e{[
 		Children			children;	// q{[
-		DirectX::XMMATRIX	mat;		// ϊs
+		DirectX::XMMATRIX	mat;		// ϊs(ǂݍݎ̎p)
 	};
 	using Nodes = std::vector<Node>;
 
@@ -126,17 +140,27 @@ public:
 	};
 	using Materials = std::vector<Material>;
 
-	// Aj[V
+	// Aj[V(ĐԂȂǂ AnimationInstance )
 	struct Animation
 	{
-		float		nowTime;	// ݂̍Đ
+		std::string	source;		// ǂݍ݌̃t@C
 		float		totalTime;	// őĐ
-		float		speed;		// Đx
-		bool		isLoop;		// [vw
 		Channels	channels;	// ϊ
+		std::shared_ptr<const AnimationClip>	clip;	// L[̎(AssetManager ̃LbVƋL)
 	};
 	using Animations = std::vector<Animation>;
 
+	// L[Ԃ̃x`}[N
+	struct SampleBenchmarkResult
+	{
+		size_t	clipCount = 0;
+		size_t	channelCount = 0;
+		size_t	sampleCount = 0;	// SNbvES`l̕ԉ
+		bool	match = true;		// 2̕@̌ʂv
+		double	mapMs = 0.0;		// ]: std::map + upper_bound
+		double	flatMs = 0.0;		// z + Đʒu̎z
+	};
+
 public:
 	Model();
 	~Model();
@@ -144,7 +168,8 @@ public:
 	void SetVertexShader(VertexShader* vs);
 	void SetPixelShader(PixelShader* ps);
 	bool Load(const char* file, float scale = 1.0f, Flip flip = Flip::None);
-	void Draw(int meshNo, Texture* overrideTex);
+	// pose  nullptr Ȃǂݍݎ̎pAoverrideVS  nullptr Ȃ SetVertexShader ̂̂ŕ`
+	void Draw(int meshNo, Texture* overrideTex, const AnimationInstance* pose = nullptr, VertexShader* overrideVS = nullptr);
 	inline void Draw(int meshNo = -1) { Draw(meshNo, nullptr); }
 
 	//--- e擾
@@ -152,38 +177,25 @@ public:
 	uint32_t GetMeshNum();
 	const Material* GetMaterial(unsigned int index);
 	uint32_t GetMaterialNum();
-	DirectX::XMMATRIX GetBone(NodeIndex index);
-	const Animation* GetAnimation(AnimeNo no);
+	DirectX::XMMATRIX GetBone(NodeIndex index) const;
+	uint32_t GetNodeNum() const;
+	const Animation* GetAnimation(AnimeNo no) const;
+	uint32_t GetAnimationNum() const;
 
 	//--- Aj[V
-	// Aj[V̓ǂݍ
+	// Aj[V̓ǂݍ(t@C͓ǂݒAO̔ԍԂ)
+	// L[ AssetManager::GetAnimationClip ̃LbV̂ŁAʂ̃fœǂݍݍς݂Ȃ I/O ͋NȂ
 	AnimeNo AddAnimation(const char* file);
-	// Aj[V̍XV
-	void Step(float tick);
-
-	// Aj[V̍Đ
-	void Play(AnimeNo no, bool loop, float speed = 1.0f);
-	// Aj[ṼuhĐ
-	void PlayBlend(AnimeNo no, float blendTime, bool loop, float speed = 1.0f);
-	// Aj[V̍ݒ
-	void SetParametric(AnimeNo no1, AnimeNo no2);
-	// Aj[V̍ݒ
-	void SetParametricBlend(float blendRate);
-	// Aj[V̌ݍĐԂύX
-	void SetAnimationTime(AnimeNo no, float time);
-	// Aj[V~
-	void StopAnimation();
-
-	// ĐtO
-	bool IsPlay(AnimeNo no);
-	// ݍĐ̃Ajԍ
-	AnimeNo GetPlayNo();
-	// uh̃Ajԍ
-	AnimeNo GetBlendNo();
+	// ǂݍݍς݂̃Nbvǉ
+	AnimeNo AddAnimation(const std::shared_ptr<const AnimationClip>& clip);
+
+	// ǂݍݍς݂̃Aj[V frames t[TvOA
+	// ] std::map Ɣׂ(ĐԂ͕ύXȂ)
+	SampleBenchmarkResult RunSampleBenchmark(int frames = 600, float tick = 1.0f / 60.0f) const;
 
 #ifdef _DEBUG
 	static std::string GetError();
-	void DrawBone();
+	void DrawBone(const AnimationInstance* pose = nullptr);
 #endif
 
 
@@ -193,14 +205,14 @@ private:
 	void MakeMaterial(const void* ptr, std::string directory);
 	void MakeBoneNodes(const void* ptr);
 	void MakeWeight(const void* ptr, int meshIdx);
+	void MakeBindPalette();
+
+	// p(m_nodes Ɠ)XLjOsBAnimationInstance ͎p̍XVɌĂ
+	void MakePalette(const DirectX::XMMATRIX* pose, std::vector<DirectX::XMFLOAT4X4>& palette) const;
 
 	// vZ
-	bool AnimeNoCheck(AnimeNo no);
-	void InitAnime(AnimeNo no);
-	void CalcAnime(AnimeTransform kind, AnimeNo no);
-	void UpdateAnime(AnimeNo no, float tick);
-	void CalcBones(NodeIndex node, const DirectX::XMMATRIX parent);
-	void LerpTransform(Transform* pOut, const Transform& a, const Transform& b, float rate);
+	static void SampleTimeline(const Timeline& timeline, float time, uint32_t* pCursor, Transform* pOut);
+	static void LerpTransform(Transform* pOut, const Transform& a, const Transform& b, float rate);
 
 private:
 	static VertexShader* m_pDefVS;		// ftHg_VF[_[
@@ -216,19 +228,14 @@ private:
 
 	Meshes			m_meshes;		// bVz
 	Materials		m_materials;	// }eAz
-	Nodes			m_nodes;		// Kw
+	Nodes			m_nodes;		// Kw(e͕KqO)
+	std::vector<NodeIndex>	m_nodeParents;	// m_nodes Ɠт̐eԍ(pvZO1ōς܂邽)
+	uint64_t		m_skeletonKey;	// m[h̕т̃nbV(AnimationClip ̃m[hԍ̊蓖ĂɎg)
 	Animations		m_animes;		// Ajz
+	std::vector<UINT>	m_paletteOffsets;	// bVƂ̃XLjOs̊Jnʒu(͍v)
+	std::vector<DirectX::XMFLOAT4X4>	m_bindPalette;	// ǂݍݎ̎p̃XLjOs
 	VertexShader* m_pVS;			// ݒ蒆̒_VF[_
 	PixelShader* m_pPS;			// ݒ蒆̃sNZVF[_
-
-	AnimeNo			m_playNo;			// ݍĐ̃Ajԍ
-	AnimeNo			m_blendNo;			// uhĐsAjԍ
-	AnimeNo			m_parametric[2];	// ĐsAjԍ
-	float			m_blendTime;		// ݂̑Jڌoߎ
-	float			m_blendTotalTime;	// AjJڂɂ鍇v
-	float			m_parametricBlend;	// pgbN̍Đ
-
-	Transforms		m_nodeTransform[MAX_TRANSFORM];	// Aj[Vʕό`
 };
 
 
@@ -3,9 +3,13 @@
 #include "ECS/Prefabs/PrefabRegistry.h"
 #include "ECS/Components/Physics/TransformComponent.h"
 #include "ECS/Components/Gimick/MovingPlatformComponent.h"
+#include "ECS/Components/Physics/Collider2DComponent.h"
+#include "ECS/Tag/Tag.h"
 #include "System/Debug.h"
+#include "System/TileCollisionMap.h"
 
 #include <fstream>
+#include <vector>
 #include "libs/nlohmann/json.hpp"
 #include <DirectXMath.h>
 
@@ -42,7 +46,51 @@ static float GetFloatProperty(const json& properties, const std::string& name, f
     return defaultValue;
 }
 
-bool StageLoader::Load(const std::string& filePath, World& world, PrefabRegistry& prefabs)
+// ^CPʂ̋`i^CWƕEj
+struct TileRect
+{
+    int x;
+    int y;
+    int w;
+    int h;
+};
+
+// ܂Ă^CA×~@ő傫ȋ`ɂ܂Ƃ߂
+// ̍s珇ɁA܂֐L΂邾L΂Aɂ̂̕܂܉֐L΂邾L΂
+static std::vector<TileRect> MergeSolidTiles(const std::vector<std::uint8_t>& solid, int width, int height)
+{
+    std::vector<TileRect> rects;
+    std::vector<std::uint8_t> used(solid.size(), 0);
+    const auto isFree = [&](int x, int y) { const int i = y * width + x; return solid[i] && !used[i]; };
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            if (!isFree(x, y)) continue;
+
+            int w = 1;
+            while (x + w < width && isFree(x + w, y)) ++w;
+
+            int h = 1;
+            for (; y + h < height; ++h)
+            {
+                bool rowFilled = true;
+                for (int k = 0; k < w && rowFilled; ++k) rowFilled = isFree(x + k, y + h);
+                if (!rowFilled) break;
+            }
+
+            for (int j = 0; j < h; ++j)
+                for (int k = 0; k < w; ++k)
+                    used[(y + j) * width + (x + k)] = 1;
+
+            rects.push_back(TileRect{ x, y, w, h });
+        }
+    }
+    return rects;
+}
+
+bool StageLoader::Load(const std::string& filePath, World& world, PrefabRegistry& prefabs, TileCollisionMap* tileMap)
 {
     std::ifstream file(filePath);
     if (!file.is_open())
@@ -71,6 +119,12 @@ bool StageLoader::Load(const std::string& filePath, World& world, PrefabRegistry
     const float pxToWorldY = worldTileH / tilePixH;
     const float mapHeightWorld = static_cast<float>(mapTilesY) * worldTileH; // ]p
 
+    // ^C̓̓}bvŜ𕢂iqɏށi[h_j
+    if (tileMap)
+    {
+        tileMap->Reset(mapTilesX, mapTilesY, 0.0f, 0.0f, worldTileW, worldTileH);
+    }
+
     if (!data.contains("layers"))
     {
         Debug::Log(LogLevel::Warning, "Stage file has no layers: " + filePath);
@@ -192,6 +246,16 @@ bool StageLoader::Load(const std::string& filePath, World& world, PrefabRegistry
 
             const auto& tiles = layer["data"];
             const int width = layer.value("width", 0);
+            if (width <= 0) continue;
+            const int height = static_cast<int>((tiles.size() + width - 1) / width);
+
+            // ڂ̓^CƂɐA肾ł܂Ƃ߂
+            std::vector<std::uint8_t> solid(static_cast<std::size_t>(width) * height, 0);
+            Collider2DComponent colTemplate;
+            bool hasCollider = false;
+            bool dynamicCollider = false;
+            int tileCount = 0;
+
             int index = 0;
             for (const auto& tileGid : tiles)
             {
@@ -210,10 +274,83 @@ bool StageLoader::Load(const std::string& filePath, World& world, PrefabRegistry
                     sp.position.y = mapHeightWorld - tileY * worldTileH - 0.5f * worldTileH;
                     sp.position.z = 0.0f;
 
-                    prefabs.Spawn(layerType, world, sp);
+                    const EntityId e = prefabs.Spawn(layerType, world, sp);
+                    if (e != kInvalidEntity && world.Has<Collider2DComponent>(e))
+                    {
+                        // RC_̐ݒ͍ŏ̃^Ĉ̂g񂷁ivnuȂ̂œj
+                        if (!hasCollider)
+                        {
+                            colTemplate = world.Get<Collider2DComponent>(e);
+                            dynamicCollider = world.Has<TagDynamicCollider>(e);
+                            hasCollider = true;
+                        }
+                        world.Remove<Collider2DComponent>(e);
+                        world.Remove<TagDynamicCollider>(e);
+                        solid[index] = 1;
+                        ++tileCount;
+                    }
                 }
                 ++index;
             }
+
+            if (!hasCollider) continue;
+
+            // Ȃ̂̃^C͊iqɏނɂiRC_GeBeB͍Ȃj
+            if (tileMap && colTemplate.isStatic && !colTemplate.isTrigger)
+            {
+                int outside = 0;
+                for (int i = 0; i < static_cast<int>(solid.size()); ++i)
+                {
+                    if (!solid[i]) continue;
+
+                    // ځEIuWFNgƓ}bv̍sŔ]
+                    const int cellX = i % width;
+                    const int cellY = mapTilesY - 1 - i / width;
+                    if (cellX >= tileMap->GetWidth() || cellY < 0 || cellY >= mapTilesY)
+                    {
+                        ++outside;
+                        continue;
+                    }
+                    tileMap->SetSolid(cellX, cellY, true);
+                }
+                tileMap->AddLayer(colTemplate.layer, colTemplate.hitMask);
+                if (outside > 0)
+                {
+                    Debug::Log(LogLevel::Warning, "Tile layer \"" + layerType + "\": " + std::to_string(outside)
+                        + " tiles outside the map size were skipped");
+                }
+
+                Debug::Log(LogLevel::Info, "Tile layer \"" + layerType + "\": " + std::to_string(tileCount)
+                    + " tiles -> tile collision map");
+                continue;
+            }
+
+            // ׂ荇^C`ɂ܂Ƃ߁A`Ƃɓp̃GeBeB1
+            // a̓vnu1^C̔aɁA^CԂ𑫂
+            const std::vector<TileRect> rects = MergeSolidTiles(solid, width, height);
+            for (const TileRect& r : rects)
+            {
+                const EntityId e = world.Create();
+                if (e == kInvalidEntity) break;
+
+                const DirectX::XMFLOAT3 center{
+                    (r.x + r.w * 0.5f) * worldTileW,
+                    mapHeightWorld - (r.y + r.h * 0.5f) * worldTileH,
+                    0.0f };
+                world.Add<TransformComponent>(e, center, DirectX::XMFLOAT3{ 0.0f, 0.0f, 0.0f }, DirectX::XMFLOAT3{ 1.0f, 1.0f, 1.0f });
+
+                Collider2DComponent col = colTemplate;
+                col.aabb.halfX = colTemplate.aabb.halfX + (r.w - 1) * worldTileW * 0.5f;
+                col.aabb.halfY = colTemplate.aabb.halfY + (r.h - 1) * worldTileH * 0.5f;
+                world.Add<Collider2DComponent>(e, col);
+                if (dynamicCollider)
+                {
+                    world.Add<TagDynamicCollider>(e);
+                }
+            }
+
+            Debug::Log(LogLevel::Info, "Tile layer \"" + layerType + "\": " + std::to_string(tileCount)
+                + " tiles -> " + std::to_string(rects.size()) + " colliders");
         }
     }
 
@@ -5,6 +5,7 @@
 // O錾
 class World;
 class PrefabRegistry;
+class TileCollisionMap;
 
 namespace DirectX
 {
@@ -23,9 +24,10 @@ public:
      * @param filePath Xe[Wt@C̃pX (JSON)
      * @param world GeBeB𐶐World
      * @param prefabs PrefabRegistryCX^X
+     * @param tileMap w肵ꍇA^CC[̓̓RC_GeBeB炸ɏ
      * @return ǂݍ݂Ɛɐꍇtrue
      */
-    bool Load(const std::string& filePath, World& world, PrefabRegistry& prefabs);
+    bool Load(const std::string& filePath, World& world, PrefabRegistry& prefabs, TileCollisionMap* tileMap = nullptr);
 
 private:
     // Tiled̍WQ[̍Wɕϊwp[֐Ȃǂɒǉł܂B
@@ -0,0 +1,47 @@
+/*****************************************************************//**
+ * @file   TileCollisionMap.cpp
+ * @brief  ^CC[̓iq̎
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#include "TileCollisionMap.h"
+
+void TileCollisionMap::Reset(int width, int height, float originX, float originY, float cellW, float cellH)
+{
+    m_width = (width > 0) ? width : 0;
+    m_height = (height > 0) ? height : 0;
+    m_originX = originX;
+    m_originY = originY;
+    m_cellW = cellW;
+    m_cellH = cellH;
+    m_invCellW = 1.0f / cellW;
+    m_invCellH = 1.0f / cellH;
+    m_cells.assign(static_cast<std::size_t>(m_width) * m_height, 0);
+    m_solidCount = 0;
+    m_layer = m_hitMask = 0;
+}
+
+void TileCollisionMap::Clear()
+{
+    m_width = m_height = 0;
+    m_cells.clear();
+    m_solidCount = 0;
+    m_layer = m_hitMask = 0;
+}
+
+void TileCollisionMap::SetSolid(int x, int y, bool solid)
+{
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+    {
+        return;
+    }
+
+    std::uint8_t& cell = m_cells[static_cast<std::size_t>(y) * m_width + x];
+    if ((cell != 0) != solid)
+    {
+        if (solid) ++m_solidCount;
+        else       --m_solidCount;
+        cell = solid ? 1 : 0;
+    }
+}
@@ -0,0 +1,113 @@
+/*****************************************************************//**
+ * @file   TileCollisionMap.h
+ * @brief  ^CC[̓1oCg/ZŎiq
+ *
+ * StageLoader  Tiled  tilelayer APhysicsStepSystem 
+ * IRC_ AABB dȂZĉ߂Ɏg܂B
+ * n`^CƂ̃RC_GeBeBŎɍς݂܂B
+ *
+ * Wn:
+ *  - Z (x, y) ͍_Ax ͉EAy ͏ɑiQ[Ɠj
+ *  - Z (x, y) ̃[h͈͂ origin + (x, y) * cellSize  cellSize 
+ *
+ * @author E
+ * @date   2025/11/13
+ *********************************************************************/
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "ECS/Components/Physics/CollisionHelpers.h"
+#include "ECS/Components/Physics/PhysicsLayers.h"
+
+class TileCollisionMap
+{
+public:
+    /**
+     * @brief SZECō蒼
+     * @param width / height Z
+     * @param originX / originY Z(0, 0)̍̃[hW
+     * @param cellW / cellH Z1̃[hTCY
+     */
+    void Reset(int width, int height, float originX, float originY, float cellW, float cellH);
+
+    /// ɂiEmpty()  true ɂȂj
+    void Clear();
+
+    bool Empty() const { return m_width == 0 || m_height == 0 || m_solidCount == 0; }
+
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+    float GetCellWidth() const { return m_cellW; }
+    float GetCellHeight() const { return m_cellH; }
+    std::size_t GetSolidCount() const { return m_solidCount; }
+
+    /// Z𖄂߂ / 󂯂i͈͊O͖j
+    void SetSolid(int x, int y, bool solid);
+
+    /// Z܂Ă邩i͈͊O͋󈵂j
+    bool IsSolid(int x, int y) const
+    {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height
+            && m_cells[static_cast<std::size_t>(y) * m_width + x] != 0;
+    }
+
+    /// [hW  Zԍi͈͊OvZBint Ɏ܂悤ۂ߂j
+    int CellX(float worldX) const { return ToCell((worldX - m_originX) * m_invCellW); }
+    int CellY(float worldY) const { return ToCell((worldY - m_originY) * m_invCellH); }
+
+    /// Z̃[h͈
+    WorldAabb2D CellBounds(int x, int y) const
+    {
+        const float minX = m_originX + x * m_cellW;
+        const float minY = m_originY + y * m_cellH;
+        return WorldAabb2D{ minX, minY, minX + m_cellW, minY + m_cellH };
+    }
+
+    //====================================================================
+    // ̐ݒi^C̃vnũRC_j
+    //====================================================================
+
+    /// ^C̃C𑫂ĩ^CC[񂾏ꍇ͘aɂȂj
+    void AddLayer(Physics::LayerMask layer, Physics::LayerMask hitMask)
+    {
+        m_layer |= layer;
+        m_hitMask |= hitMask;
+    }
+
+    /// ^C̃Ci񂾃^CC[̘aj
+    Physics::LayerMask GetLayer() const { return m_layer; }
+
+    ///  layer / hitMask ̃RC_^CƓ邩
+    bool CanCollide(Physics::LayerMask layer, Physics::LayerMask hitMask) const
+    {
+        return (hitMask & m_layer) != 0 || (m_hitMask & layer) != 0;
+    }
+
+private:
+    static int ToCell(float v)
+    {
+        const float c = std::floor(v);
+        if (c < -1.0e9f) return -1000000000;
+        if (c > 1.0e9f) return 1000000000;
+        return static_cast<int>(c);
+    }
+
+private:
+    int   m_width = 0;
+    int   m_height = 0;
+    float m_originX = 0.0f;
+    float m_originY = 0.0f;
+    float m_cellW = 1.0f;
+    float m_cellH = 1.0f;
+    float m_invCellW = 1.0f;
+    float m_invCellH = 1.0f;
+
+    /// 1Z1oCgi0 = jBsƂɉׂ
+    std::vector<std::uint8_t> m_cells;
+    std::size_t m_solidCount = 0;
+
+    Physics::LayerMask m_layer = 0;
+    Physics::LayerMask m_hitMask = 0;
+};